@@ -0,0 +1,48 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_ALLOCATION_COUNTER_HPP
+#define ERR_ALLOCATION_COUNTER_HPP
+
+#include <string>
+#include <utility>
+
+#include <cstddef>
+
+namespace err::bench
+{
+// Number of calls to the global operator new since program start
+auto allocation_count() noexcept -> std::size_t;
+
+// Describes the number of allocations made by a call to f, to be appended to the name of a benchmark
+template<typename F>
+auto allocations_of(F&& f) -> std::string
+{
+    auto const before = allocation_count();
+    std::forward<F>(f)();
+    return " (" + std::to_string(allocation_count() - before) + " allocations per call)";
+}
+} // namespace err::bench
+
+#endif // ERR_ALLOCATION_COUNTER_HPP
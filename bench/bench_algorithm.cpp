@@ -0,0 +1,87 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "bench_errors.hpp"
+#include "benchmarks.hpp"
+
+#include "err/algorithm.hpp"
+
+#include <nanobench.h>
+
+#include <expected>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace err::bench
+{
+namespace
+{
+using error_type = error_of_size<16>;
+
+constexpr std::size_t record_count = 1'000'000;
+
+auto parse_record(std::uint32_t record) -> std::expected<std::uint64_t, error_type>
+{
+    if (record == 0)
+        return std::unexpected{error_type{bench_enum{3}}};
+    // Some work per record, so that the records outweigh the threads
+    std::uint64_t hash = record;
+    for (int i = 0; i < 16; ++i)
+        hash = (hash ^ (hash >> 31)) * 0x9e37'79b9'7f4a'7c15;
+    return hash;
+}
+} // namespace
+
+void collect_and_reduce(reporter const& report)
+{
+    std::vector<std::uint32_t> records(record_count);
+    std::iota(records.begin(), records.end(), 1);
+    auto failing              = records;
+    failing[record_count / 8] = 0;
+
+    auto const collect_all = [](auto mode, auto const& input)
+    { ankerl::nanobench::doNotOptimizeAway(collect(mode, input, parse_record)); };
+    auto const sum_all = [](auto mode, auto const& input)
+    {
+        auto const sum = transform_reduce(mode, input, std::uint64_t{0}, std::plus{}, parse_record);
+        ankerl::nanobench::doNotOptimizeAway(sum);
+    };
+
+    auto bench = report.make_bench("collect and transform_reduce of " + std::to_string(record_count) + " records");
+    bench.batch(record_count).unit("record");
+
+    bench.run("collect, sequential", [&] { collect_all(sequential, records); });
+    bench.run("collect, parallel", [&] { collect_all(parallel, records); });
+    bench.run("collect, sequential, failing early", [&] { collect_all(sequential, failing); });
+    bench.run("collect, parallel, failing early", [&] { collect_all(parallel, failing); });
+    bench.run("transform_reduce, sequential", [&] { sum_all(sequential, records); });
+    bench.run("transform_reduce, parallel", [&] { sum_all(parallel, records); });
+    report.report(bench);
+}
+} // namespace err::bench
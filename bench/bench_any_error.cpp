@@ -0,0 +1,101 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "bench_errors.hpp"
+#include "benchmarks.hpp"
+
+#include "err/any_error.hpp"
+
+#include <nanobench.h>
+
+#include <expected>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <cstddef>
+
+namespace err::bench
+{
+namespace
+{
+using error_type = error_of_size<16>;
+
+// Number of functions each error is returned through
+constexpr int layer_count = 4;
+
+// Layers are out of line, as they would be across a library boundary
+[[gnu::noinline]] auto produce_any_error(bench_enum value, int layer) -> std::expected<int, any_error>
+{
+    if (layer == 0)
+        return std::unexpected{any_error{error_type{value}}};
+    auto const result = produce_any_error(value, layer - 1);
+    if (!result)
+        return std::unexpected{result.error()};
+    return *result + 1;
+}
+
+[[gnu::noinline]] auto produce_error_code(bench_enum value, int layer) -> std::expected<int, std::error_code>
+{
+    if (layer == 0)
+        return std::unexpected{std::error_code{static_cast<int>(value), std::generic_category()}};
+    auto const result = produce_error_code(value, layer - 1);
+    if (!result)
+        return std::unexpected{result.error()};
+    return *result + 1;
+}
+} // namespace
+
+void any_error_propagation(reporter const& report)
+{
+    ankerl::nanobench::Rng rng;
+    auto const             values = random_values<16>(sample_count, rng);
+    auto                   bench  = report.make_bench("propagation across " + std::to_string(layer_count) + " layers");
+    bench.batch(sample_count).unit("error");
+
+    bench.run("std::error_code",
+              [&]
+              {
+                  std::size_t matches = 0;
+                  for (auto const value : values)
+                  {
+                      auto const result = produce_error_code(value, layer_count);
+                      matches += result.error() == std::error_code{3, std::generic_category()} ? 1 : 0;
+                  }
+                  ankerl::nanobench::doNotOptimizeAway(matches);
+              });
+    bench.run("err::any_error",
+              [&]
+              {
+                  std::size_t matches = 0;
+                  for (auto const value : values)
+                  {
+                      auto const result = produce_any_error(value, layer_count);
+                      matches += result.error() == bench_enum{3} ? 1 : 0;
+                  }
+                  ankerl::nanobench::doNotOptimizeAway(matches);
+              });
+    report.report(bench);
+}
+} // namespace err::bench
@@ -0,0 +1,92 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "allocation_counter.hpp"
+#include "bench_errors.hpp"
+#include "benchmarks.hpp"
+
+#include "err/context.hpp"
+
+#include <nanobench.h>
+
+#include <expected>
+#include <string>
+#include <utility>
+
+namespace err::bench
+{
+namespace
+{
+using error_type = error_of_size<16>;
+
+// Number of layers each error propagates through
+constexpr int hop_count = 5;
+
+// The usual way to attach breadcrumbs, kept as a baseline
+struct error_with_string
+{
+    error_type  error;
+    std::string context;
+};
+
+auto fail_with_string(int depth) -> std::expected<int, error_with_string>
+{
+    if (depth == 0)
+        return std::unexpected{error_with_string{error_type{bench_enum{3}}, "read block"}};
+    return fail_with_string(depth - 1).transform_error(
+        [](error_with_string e)
+        {
+            e.context += "; layer";
+            return e;
+        });
+}
+
+auto fail_with_context(int depth) -> std::expected<int, error_with_context<error_type>>
+{
+    if (depth == 0)
+        return std::unexpected{add_context(error_type{bench_enum{3}}, "read block")};
+    return fail_with_context(depth - 1).transform_error([](auto e) { return add_context(e, "layer"); });
+}
+} // namespace
+
+void context_chain(reporter const& report)
+{
+    auto bench = report.make_bench("context chain");
+    bench.unit("request");
+
+    auto const with_string = [] { ankerl::nanobench::doNotOptimizeAway(fail_with_string(hop_count)); };
+    bench.run("std::string breadcrumbs, " + std::to_string(hop_count) + " hops" + allocations_of(with_string),
+              with_string);
+
+    auto const with_context = [&]
+    {
+        context_scope const scope;
+        ankerl::nanobench::doNotOptimizeAway(fail_with_context(hop_count));
+    };
+    with_context(); // The arena of a thread allocates its memory once, on first use
+    bench.run("err::add_context, " + std::to_string(hop_count) + " hops" + allocations_of(with_context),
+              with_context);
+    report.report(bench);
+}
+} // namespace err::bench
@@ -0,0 +1,118 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_BENCH_ERRORS_HPP
+#define ERR_BENCH_ERRORS_HPP
+
+#include "err/error.hpp"
+
+#include <nanobench.h>
+
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace err::bench
+{
+// Enumerators are produced by casting their index, so errors of arbitrary size can be generated
+enum class bench_enum : std::uint16_t
+{
+};
+
+template<class Seq>
+struct make_error;
+
+template<std::size_t... Is>
+struct make_error<std::index_sequence<Is...>>
+{
+    using type = error<static_cast<bench_enum>(Is)...>;
+};
+
+template<std::size_t N>
+using error_of_size = make_error<std::make_index_sequence<N>>::type;
+
+// Sizes of errors all operations are measured with
+using error_sizes = std::index_sequence<1, 4, 16, 64, 256>;
+
+template<std::size_t... Ns, class Fn>
+void for_each_size(std::index_sequence<Ns...> /*sizes*/, Fn&& fn)
+{
+    (fn.template operator()<Ns>(), ...);
+}
+
+// Number of elements each benchmark iterates over
+inline constexpr std::size_t sample_count = 1024;
+
+// An arbitrary non-linear mapping, so a switch over enumerators doesn't collapse into arithmetic
+constexpr auto weight(bench_enum e) noexcept -> unsigned
+{
+    return (static_cast<unsigned>(e) * 2654435761U) >> 24U;
+}
+
+template<std::size_t N>
+constexpr auto next(bench_enum e) noexcept -> bench_enum
+{
+    return static_cast<bench_enum>((static_cast<std::size_t>(e) + 1) % N);
+}
+
+template<std::size_t N>
+auto random_values(std::size_t count, ankerl::nanobench::Rng& rng) -> std::vector<bench_enum>
+{
+    std::vector<bench_enum> result;
+    result.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        result.push_back(static_cast<bench_enum>(rng.bounded(N)));
+    return result;
+}
+
+template<class Error>
+auto random_errors(std::size_t count, ankerl::nanobench::Rng& rng) -> std::vector<Error>
+{
+    std::vector<Error> result;
+    result.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        result.emplace_back(Error::possible_values[rng.bounded(Error::possible_values.size())]);
+    return result;
+}
+
+// The way errors were visited before dispatch tables, kept as a baseline
+template<auto... Es>
+constexpr auto to_variant(detail::error_impl<Es...> e) -> std::variant<detail::error_impl<Es>...>
+{
+    std::variant<detail::error_impl<Es>...> var{};
+    using value_type = detail::error_impl<Es...>::value_type;
+    auto fn          = [&e, &var]<value_type E>()
+    {
+        if (static_cast<value_type>(e) == E)
+            var = detail::error_impl<E>{};
+    };
+    (fn.template operator()<Es>(), ...);
+    return var;
+}
+} // namespace err::bench
+
+#endif // ERR_BENCH_ERRORS_HPP
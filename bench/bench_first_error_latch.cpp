@@ -0,0 +1,102 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "bench_errors.hpp"
+#include "benchmarks.hpp"
+
+#include "err/first_error_latch.hpp"
+
+#include <nanobench.h>
+
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cstddef>
+
+namespace err::bench
+{
+namespace
+{
+using error_type = error_of_size<16>;
+
+// Number of failing tasks each thread runs per measurement, so that starting the threads is amortized
+constexpr std::size_t tasks_per_thread = 10'000;
+
+// The usual way to record the first error of a task group, kept as a baseline
+class mutex_latch
+{
+  public:
+    auto try_set(error_type e) -> bool
+    {
+        std::scoped_lock const lock{m_mutex};
+        if (m_error)
+            return false;
+        m_error = e;
+        return true;
+    }
+
+  private:
+    std::mutex                m_mutex;
+    std::optional<error_type> m_error;
+};
+
+// Every task of every thread fails at the same time, which is the worst case for contention
+template<class Latch>
+void fail_all(std::size_t thread_count)
+{
+    Latch latch;
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(thread_count);
+        for (std::size_t t = 0; t < thread_count; ++t)
+            threads.emplace_back(
+                [&latch, t]
+                {
+                    std::size_t won = 0;
+                    for (std::size_t i = 0; i < tasks_per_thread; ++i)
+                        won += latch.try_set(error_type{static_cast<bench_enum>((t + i) % 16)}) ? 1 : 0;
+                    ankerl::nanobench::doNotOptimizeAway(won);
+                });
+    }
+}
+} // namespace
+
+void first_error_latch_contention(reporter const& report)
+{
+    auto bench = report.make_bench("first error of a task group");
+    bench.unit("task");
+
+    for (std::size_t const thread_count : {1, 2, 4, 8, 16, 32, 64})
+    {
+        auto const suffix = ", " + std::to_string(thread_count) + " threads";
+        bench.batch(thread_count * tasks_per_thread);
+        bench.run("std::mutex + std::optional" + suffix, [&] { fail_all<mutex_latch>(thread_count); });
+        bench.run("err::first_error_latch" + suffix, [&] { fail_all<first_error_latch<error_type>>(thread_count); });
+    }
+    report.report(bench);
+}
+} // namespace err::bench
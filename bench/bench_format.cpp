@@ -0,0 +1,119 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "allocation_counter.hpp"
+#include "bench_errors.hpp"
+#include "benchmarks.hpp"
+
+#include "err/format.hpp"
+
+#include <nanobench.h>
+
+#include <array>
+#include <format>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+namespace err::bench
+{
+namespace
+{
+enum class io_error
+{
+    not_found,
+    permission_denied,
+    connection_refused,
+    connection_reset,
+    timed_out,
+    would_block,
+    interrupted,
+    unexpected_eof,
+};
+using enum io_error;
+
+using io_error_type = error<not_found,
+                            permission_denied,
+                            connection_refused,
+                            connection_reset,
+                            timed_out,
+                            would_block,
+                            interrupted,
+                            unexpected_eof>;
+} // namespace
+
+void formatting(reporter const& report)
+{
+    ankerl::nanobench::Rng rng;
+    auto                   bench = report.make_bench("formatting");
+    bench.batch(sample_count).unit("error");
+
+    std::vector<io_error_type> errors;
+    for (std::size_t i = 0; i < sample_count; ++i)
+        errors.emplace_back(io_error_type::possible_values[rng.bounded(io_error_type::possible_values.size())]);
+
+    std::size_t total = 0;
+    auto const  to_string = [&]
+    {
+        for (auto const e : errors)
+            total += std::to_string(std::to_underlying(static_cast<io_error>(e))).size();
+    };
+    bench.run("std::to_string of the underlying value" + allocations_of(to_string),
+              [&]
+              {
+                  to_string();
+                  ankerl::nanobench::doNotOptimizeAway(total);
+              });
+
+    std::array<char, 32> buffer{};
+    auto const           format_to_n = [&]
+    {
+        for (auto const e : errors)
+            total += static_cast<std::size_t>(std::format_to_n(buffer.data(), buffer.size(), "{}", e).size);
+    };
+    bench.run("std::format_to_n of the name" + allocations_of(format_to_n),
+              [&]
+              {
+                  format_to_n();
+                  ankerl::nanobench::doNotOptimizeAway(total);
+                  ankerl::nanobench::doNotOptimizeAway(buffer);
+              });
+
+    auto const name = [&]
+    {
+        for (auto const e : errors)
+            total += e.name().size();
+    };
+    bench.run("error::name" + allocations_of(name),
+              [&]
+              {
+                  name();
+                  ankerl::nanobench::doNotOptimizeAway(total);
+              });
+    report.report(bench);
+}
+} // namespace err::bench
@@ -0,0 +1,83 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "bench_errors.hpp"
+#include "benchmarks.hpp"
+
+#include <nanobench.h>
+
+#include <string>
+#include <variant>
+#include <vector>
+
+#include <cstddef>
+
+namespace err::bench
+{
+namespace
+{
+constexpr auto sum_values = [](auto... es) { return (static_cast<int>(static_cast<bench_enum>(es)) + ...); };
+
+template<std::size_t N, std::size_t Arity>
+void run(reporter const& report, ankerl::nanobench::Rng& rng)
+{
+    using error_type = error_of_size<N>;
+    std::vector<std::vector<error_type>> samples;
+    for (std::size_t i = 0; i < Arity; ++i)
+        samples.push_back(random_errors<error_type>(sample_count, rng));
+
+    auto bench = report.make_bench("multi visit vs. std::visit, " + std::to_string(Arity) + "x" + std::to_string(N));
+    bench.batch(sample_count).unit("visit");
+
+    [&]<std::size_t... Is>(std::index_sequence<Is...>)
+    {
+        bench.run("std::visit",
+                  [&]
+                  {
+                      int sum = 0;
+                      for (std::size_t i = 0; i < sample_count; ++i)
+                          sum += std::visit(sum_values, to_variant(samples[Is][i])...);
+                      ankerl::nanobench::doNotOptimizeAway(sum);
+                  });
+        bench.run("err::visit",
+                  [&]
+                  {
+                      int sum = 0;
+                      for (std::size_t i = 0; i < sample_count; ++i)
+                          sum += visit(sum_values, samples[Is][i]...);
+                      ankerl::nanobench::doNotOptimizeAway(sum);
+                  });
+    }(std::make_index_sequence<Arity>{});
+    report.report(bench);
+}
+} // namespace
+
+void multi_visit_vs_std_visit(reporter const& report)
+{
+    ankerl::nanobench::Rng rng;
+    run<16, 2>(report, rng);
+    run<16, 3>(report, rng);
+    run<64, 2>(report, rng);
+}
+} // namespace err::bench
@@ -0,0 +1,238 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "bench_errors.hpp"
+#include "benchmarks.hpp"
+
+#include "err/error_map.hpp"
+
+#include <nanobench.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <cstddef>
+
+namespace err::bench
+{
+void construction(reporter const& report)
+{
+    ankerl::nanobench::Rng rng;
+    auto                   bench = report.make_bench("construction from value_type");
+    bench.batch(sample_count).unit("construction");
+    for_each_size(error_sizes{},
+                  [&]<std::size_t N>()
+                  {
+                      using error_type  = error_of_size<N>;
+                      auto const values = random_values<N>(sample_count, rng);
+
+                      std::vector<bench_enum> raw(sample_count);
+                      bench.run("raw enum, " + std::to_string(N) + " enumerators",
+                                [&]
+                                {
+                                    for (std::size_t i = 0; i < sample_count; ++i)
+                                        raw[i] = values[i];
+                                    ankerl::nanobench::doNotOptimizeAway(raw.data());
+                                });
+
+                      std::vector<error_type> errors(sample_count, error_type{error_type::possible_values[0]});
+                      bench.run("err::error, " + std::to_string(N) + " enumerators",
+                                [&]
+                                {
+                                    for (std::size_t i = 0; i < sample_count; ++i)
+                                        errors[i] = error_type{values[i]};
+                                    ankerl::nanobench::doNotOptimizeAway(errors.data());
+                                });
+                  });
+    report.report(bench);
+}
+
+void contract_levels(reporter const& report)
+{
+#if ERR_CONTRACT_LEVEL == ERR_CONTRACT_LEVEL_UNCHECKED
+    std::string const level = "unchecked";
+#elif ERR_CONTRACT_LEVEL == ERR_CONTRACT_LEVEL_CHECKED
+    std::string const level = "checked";
+#else
+    std::string const level = "audit";
+#endif
+
+    ankerl::nanobench::Rng rng;
+    auto                   bench = report.make_bench("construction from value_type by contract level");
+    bench.batch(sample_count).unit("construction");
+    for_each_size(error_sizes{},
+                  [&]<std::size_t N>()
+                  {
+                      using error_type  = error_of_size<N>;
+                      auto const values = random_values<N>(sample_count, rng);
+                      auto const suffix = ", " + std::to_string(N) + " enumerators";
+
+                      std::vector<error_type> errors(sample_count, error_type{error_type::possible_values[0]});
+                      bench.run("constructor, ERR_CONTRACT_LEVEL " + level + suffix,
+                                [&]
+                                {
+                                    for (std::size_t i = 0; i < sample_count; ++i)
+                                        errors[i] = error_type{values[i]};
+                                    ankerl::nanobench::doNotOptimizeAway(errors.data());
+                                });
+                      bench.run("err::unchecked" + suffix,
+                                [&]
+                                {
+                                    for (std::size_t i = 0; i < sample_count; ++i)
+                                        errors[i] = error_type{unchecked, values[i]};
+                                    ankerl::nanobench::doNotOptimizeAway(errors.data());
+                                });
+                      bench.run("err::checked_from" + suffix,
+                                [&]
+                                {
+                                    std::size_t invalid = 0;
+                                    for (std::size_t i = 0; i < sample_count; ++i)
+                                    {
+                                        auto const e = checked_from<error_type>(values[i]);
+                                        invalid += e ? 0 : 1;
+                                        errors[i] = e.value_or(errors[i]);
+                                    }
+                                    ankerl::nanobench::doNotOptimizeAway(invalid);
+                                    ankerl::nanobench::doNotOptimizeAway(errors.data());
+                                });
+                  });
+    report.report(bench);
+}
+
+void conversion(reporter const& report)
+{
+    ankerl::nanobench::Rng rng;
+    auto                   bench = report.make_bench("conversion between related errors");
+    bench.batch(sample_count).unit("conversion");
+    for_each_size(error_sizes{},
+                  [&]<std::size_t N>()
+                  {
+                      using narrow_type = error_of_size<N>;
+                      using wide_type   = error_of_size<N + 1>;
+                      auto const narrow = random_errors<narrow_type>(sample_count, rng);
+                      auto const raw    = random_values<N>(sample_count, rng);
+                      std::vector<wide_type> const wide(narrow.begin(), narrow.end());
+
+                      std::vector<bench_enum> raw_out(sample_count);
+                      bench.run("raw enum, " + std::to_string(N) + " enumerators",
+                                [&]
+                                {
+                                    for (std::size_t i = 0; i < sample_count; ++i)
+                                        raw_out[i] = raw[i];
+                                    ankerl::nanobench::doNotOptimizeAway(raw_out.data());
+                                });
+
+                      std::vector<wide_type> wide_out(sample_count, wide_type{wide_type::possible_values[0]});
+                      bench.run("widening, " + std::to_string(N) + " enumerators",
+                                [&]
+                                {
+                                    for (std::size_t i = 0; i < sample_count; ++i)
+                                        wide_out[i] = narrow[i];
+                                    ankerl::nanobench::doNotOptimizeAway(wide_out.data());
+                                });
+
+                      std::vector<narrow_type> narrow_out(sample_count, narrow_type{narrow_type::possible_values[0]});
+                      bench.run("narrowing, " + std::to_string(N) + " enumerators",
+                                [&]
+                                {
+                                    for (std::size_t i = 0; i < sample_count; ++i)
+                                        narrow_out[i] = narrow_type{wide[i]};
+                                    ankerl::nanobench::doNotOptimizeAway(narrow_out.data());
+                                });
+                  });
+    report.report(bench);
+}
+
+void equality(reporter const& report)
+{
+    ankerl::nanobench::Rng rng;
+    auto                   bench = report.make_bench("operator==");
+    bench.batch(sample_count).unit("comparison");
+    for_each_size(error_sizes{},
+                  [&]<std::size_t N>()
+                  {
+                      using error_type    = error_of_size<N>;
+                      using related_type  = error_of_size<N + 1>;
+                      auto const lhs      = random_errors<error_type>(sample_count, rng);
+                      auto const rhs      = random_errors<error_type>(sample_count, rng);
+                      auto const raw_lhs  = random_values<N>(sample_count, rng);
+                      auto const raw_rhs  = random_values<N>(sample_count, rng);
+                      auto const related  = random_errors<related_type>(sample_count, rng);
+                      auto const suffix   = ", " + std::to_string(N) + " enumerators";
+                      auto const count_eq = [&](auto const& a, auto const& b)
+                      {
+                          std::size_t equal = 0;
+                          for (std::size_t i = 0; i < sample_count; ++i)
+                              equal += a[i] == b[i] ? 1 : 0;
+                          ankerl::nanobench::doNotOptimizeAway(equal);
+                      };
+
+                      bench.run("raw enum" + suffix, [&] { count_eq(raw_lhs, raw_rhs); });
+                      bench.run("same error type" + suffix, [&] { count_eq(lhs, rhs); });
+                      bench.run("related error type" + suffix, [&] { count_eq(lhs, related); });
+                      bench.run("value_type" + suffix, [&] { count_eq(lhs, raw_rhs); });
+                  });
+    report.report(bench);
+}
+
+void hash_lookup(reporter const& report)
+{
+    ankerl::nanobench::Rng rng;
+    auto                   bench = report.make_bench("lookup by error");
+    bench.batch(sample_count).unit("lookup");
+    for_each_size(error_sizes{},
+                  [&]<std::size_t N>()
+                  {
+                      using error_type  = error_of_size<N>;
+                      auto const errors = random_errors<error_type>(sample_count, rng);
+                      auto const raw    = random_values<N>(sample_count, rng);
+                      auto const suffix = ", " + std::to_string(N) + " enumerators";
+
+                      std::unordered_map<bench_enum, std::size_t> raw_map;
+                      std::unordered_map<error_type, std::size_t> hash_map;
+                      error_map<error_type, std::size_t> const    flat_map{[](error_type e) { return e.index(); }};
+                      for (std::size_t i = 0; i < N; ++i)
+                      {
+                          raw_map.emplace(static_cast<bench_enum>(i), i);
+                          hash_map.emplace(error_type::from_index(i), i);
+                      }
+                      auto const sum_of = [&](auto const& keys, auto&& lookup)
+                      {
+                          std::size_t sum = 0;
+                          for (auto const& key : keys)
+                              sum += lookup(key);
+                          ankerl::nanobench::doNotOptimizeAway(sum);
+                      };
+
+                      bench.run("std::unordered_map<raw enum>" + suffix,
+                                [&] { sum_of(raw, [&](bench_enum e) { return raw_map.find(e)->second; }); });
+                      bench.run("std::unordered_map<err::error>" + suffix,
+                                [&] { sum_of(errors, [&](error_type e) { return hash_map.find(e)->second; }); });
+                      bench.run("err::error_map" + suffix,
+                                [&] { sum_of(errors, [&](error_type e) { return flat_map[e]; }); });
+                  });
+    report.report(bench);
+}
+} // namespace err::bench
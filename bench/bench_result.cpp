@@ -0,0 +1,97 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "bench_errors.hpp"
+#include "benchmarks.hpp"
+#include "err/result.hpp"
+
+#include <nanobench.h>
+
+#include <expected>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+namespace err::bench
+{
+namespace
+{
+// Large enough to not fit into the caches
+constexpr std::size_t element_count = std::size_t{1} << 24;
+
+template<class Result>
+auto make_results(ankerl::nanobench::Rng& rng) -> std::vector<Result>
+{
+    using error_type = error_of_size<16>;
+    std::vector<Result> results;
+    results.reserve(element_count);
+    for (std::size_t i = 0; i < element_count; ++i)
+    {
+        if (rng.bounded(10) == 0)
+            results.emplace_back(std::unexpect, error_type::possible_values[rng.bounded(16)]);
+        else if constexpr (std::is_void_v<typename Result::value_type>)
+            results.emplace_back();
+        else
+            results.emplace_back(std::in_place, error_type::possible_values[rng.bounded(16)]);
+    }
+    return results;
+}
+
+template<class Result>
+void count_errors(ankerl::nanobench::Bench& bench, char const* name, ankerl::nanobench::Rng& rng)
+{
+    auto const results = make_results<Result>(rng);
+    bench.run(std::string{name} + " (" + std::to_string(sizeof(Result)) + " bytes)",
+              [&]
+              {
+                  std::size_t errors = 0;
+                  for (auto const& r : results)
+                      errors += r.has_value() ? 0 : 1;
+                  ankerl::nanobench::doNotOptimizeAway(errors);
+              });
+}
+} // namespace
+
+void result_density(reporter const& report)
+{
+    using error_type = error_of_size<16>;
+    ankerl::nanobench::Rng rng;
+
+    auto void_bench = report.make_bench("scan vector of void results");
+    void_bench.batch(element_count).unit("result");
+    count_errors<std::expected<void, error_type>>(void_bench, "std::expected", rng);
+    count_errors<result<void, error_type>>(void_bench, "err::result", rng);
+    report.report(void_bench);
+
+    // The value is an error itself, whose unused positions hold the errors of the result
+    auto error_bench = report.make_bench("scan vector of error results");
+    error_bench.batch(element_count).unit("result");
+    count_errors<std::expected<error_type, error_type>>(error_bench, "std::expected", rng);
+    count_errors<result<error_type, error_type>>(error_bench, "err::result", rng);
+    report.report(error_bench);
+}
+} // namespace err::bench
@@ -0,0 +1,86 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_BENCH_SWITCH_HPP
+#define ERR_BENCH_SWITCH_HPP
+
+#include "bench_errors.hpp"
+
+#include <utility>
+
+#include <cstddef>
+
+// Hand-written switches over the enumerators of error_of_size<N>, as a baseline for visitation
+
+#define ERR_BENCH_CASES1(CASE, I) CASE(I)
+#define ERR_BENCH_CASES4(CASE, I) CASE(I) CASE((I) + 1) CASE((I) + 2) CASE((I) + 3)
+#define ERR_BENCH_CASES16(CASE, I)                                                                                     \
+    ERR_BENCH_CASES4(CASE, I)                                                                                          \
+    ERR_BENCH_CASES4(CASE, (I) + 4) ERR_BENCH_CASES4(CASE, (I) + 8) ERR_BENCH_CASES4(CASE, (I) + 12)
+#define ERR_BENCH_CASES64(CASE, I)                                                                                     \
+    ERR_BENCH_CASES16(CASE, I)                                                                                         \
+    ERR_BENCH_CASES16(CASE, (I) + 16) ERR_BENCH_CASES16(CASE, (I) + 32) ERR_BENCH_CASES16(CASE, (I) + 48)
+#define ERR_BENCH_CASES256(CASE, I)                                                                                    \
+    ERR_BENCH_CASES64(CASE, I)                                                                                         \
+    ERR_BENCH_CASES64(CASE, (I) + 64) ERR_BENCH_CASES64(CASE, (I) + 128) ERR_BENCH_CASES64(CASE, (I) + 192)
+
+#define ERR_BENCH_WEIGHT_CASE(I)                                                                                       \
+    case static_cast<bench_enum>(I): return weight(static_cast<bench_enum>(I));
+#define ERR_BENCH_NEXT_CASE(I)                                                                                         \
+    case static_cast<bench_enum>(I): return next<size>(static_cast<bench_enum>(I));
+
+#define ERR_BENCH_SWITCH(NAME, RESULT, CASE, N, CASES)                                                                 \
+    template<>                                                                                                         \
+    inline auto NAME<N>(bench_enum e) noexcept -> RESULT                                                               \
+    {                                                                                                                  \
+        [[maybe_unused]] constexpr std::size_t size = N;                                                               \
+        switch (e)                                                                                                     \
+        {                                                                                                              \
+            CASES(CASE, 0)                                                                                             \
+        }                                                                                                              \
+        std::unreachable();                                                                                            \
+    }
+
+namespace err::bench
+{
+template<std::size_t N>
+auto switch_weight(bench_enum e) noexcept -> unsigned;
+
+ERR_BENCH_SWITCH(switch_weight, unsigned, ERR_BENCH_WEIGHT_CASE, 1, ERR_BENCH_CASES1)
+ERR_BENCH_SWITCH(switch_weight, unsigned, ERR_BENCH_WEIGHT_CASE, 4, ERR_BENCH_CASES4)
+ERR_BENCH_SWITCH(switch_weight, unsigned, ERR_BENCH_WEIGHT_CASE, 16, ERR_BENCH_CASES16)
+ERR_BENCH_SWITCH(switch_weight, unsigned, ERR_BENCH_WEIGHT_CASE, 64, ERR_BENCH_CASES64)
+ERR_BENCH_SWITCH(switch_weight, unsigned, ERR_BENCH_WEIGHT_CASE, 256, ERR_BENCH_CASES256)
+
+template<std::size_t N>
+auto switch_next(bench_enum e) noexcept -> bench_enum;
+
+ERR_BENCH_SWITCH(switch_next, bench_enum, ERR_BENCH_NEXT_CASE, 1, ERR_BENCH_CASES1)
+ERR_BENCH_SWITCH(switch_next, bench_enum, ERR_BENCH_NEXT_CASE, 4, ERR_BENCH_CASES4)
+ERR_BENCH_SWITCH(switch_next, bench_enum, ERR_BENCH_NEXT_CASE, 16, ERR_BENCH_CASES16)
+ERR_BENCH_SWITCH(switch_next, bench_enum, ERR_BENCH_NEXT_CASE, 64, ERR_BENCH_CASES64)
+ERR_BENCH_SWITCH(switch_next, bench_enum, ERR_BENCH_NEXT_CASE, 256, ERR_BENCH_CASES256)
+} // namespace err::bench
+
+#endif // ERR_BENCH_SWITCH_HPP
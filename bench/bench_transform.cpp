@@ -0,0 +1,174 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "allocation_counter.hpp"
+#include "bench_errors.hpp"
+#include "bench_switch.hpp"
+#include "benchmarks.hpp"
+
+#include <nanobench.h>
+
+#include <expected>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+namespace err::bench
+{
+namespace
+{
+template<std::size_t N>
+constexpr auto rotate = [](auto e) { return error<next<N>(decltype(e)::possible_values[0])>{}; };
+} // namespace
+
+void transform(reporter const& report)
+{
+    ankerl::nanobench::Rng rng;
+    auto                   bench = report.make_bench("transform");
+    bench.batch(sample_count).unit("transform");
+    for_each_size(error_sizes{},
+                  [&]<std::size_t N>()
+                  {
+                      using error_type  = error_of_size<N>;
+                      auto const errors = random_errors<error_type>(sample_count, rng);
+                      auto const raw    = random_values<N>(sample_count, rng);
+                      auto const suffix = ", " + std::to_string(N) + " enumerators";
+
+                      std::vector<bench_enum> raw_out(sample_count);
+                      bench.run("hand-written switch" + suffix,
+                                [&]
+                                {
+                                    for (std::size_t i = 0; i < sample_count; ++i)
+                                        raw_out[i] = switch_next<N>(raw[i]);
+                                    ankerl::nanobench::doNotOptimizeAway(raw_out.data());
+                                });
+
+                      std::vector<error_type> out(sample_count, error_type{error_type::possible_values[0]});
+                      bench.run("err::transform" + suffix,
+                                [&]
+                                {
+                                    for (std::size_t i = 0; i < sample_count; ++i)
+                                        out[i] = errors[i].transform(rotate<N>);
+                                    ankerl::nanobench::doNotOptimizeAway(out.data());
+                                });
+
+                      std::size_t calls = 0;
+                      bench.run("err::transform, stateful visitor" + suffix,
+                                [&]
+                                {
+                                    for (std::size_t i = 0; i < sample_count; ++i)
+                                        out[i] = errors[i].transform(
+                                            [&calls](auto e)
+                                            {
+                                                ++calls;
+                                                return rotate<N>(e);
+                                            });
+                                    ankerl::nanobench::doNotOptimizeAway(out.data());
+                                    ankerl::nanobench::doNotOptimizeAway(calls);
+                                });
+                  });
+    report.report(bench);
+}
+
+void transform_error(reporter const& report)
+{
+    ankerl::nanobench::Rng rng;
+    auto                   bench = report.make_bench("transform_error");
+    bench.batch(sample_count).unit("transform_error");
+    for_each_size(error_sizes{},
+                  [&]<std::size_t N>()
+                  {
+                      using error_type    = error_of_size<N>;
+                      using expected_type = std::expected<int, error_type>;
+                      using raw_type      = std::expected<int, bench_enum>;
+                      auto const suffix   = ", " + std::to_string(N) + " enumerators";
+
+                      std::vector<expected_type> expecteds;
+                      std::vector<raw_type>      raw;
+                      for (auto const e : random_errors<error_type>(sample_count, rng))
+                      {
+                          bool const ok = rng.bounded(2) == 0;
+                          expecteds.push_back(ok ? expected_type{1} : expected_type{std::unexpect, e});
+                          raw.push_back(ok ? raw_type{1} : raw_type{std::unexpect, static_cast<bench_enum>(e)});
+                      }
+
+                      std::vector<raw_type> raw_out(sample_count);
+                      bench.run("hand-written switch" + suffix,
+                                [&]
+                                {
+                                    for (std::size_t i = 0; i < sample_count; ++i)
+                                        raw_out[i] = raw[i].transform_error([](bench_enum e)
+                                                                            { return switch_next<N>(e); });
+                                    ankerl::nanobench::doNotOptimizeAway(raw_out.data());
+                                });
+
+                      std::vector<expected_type> out(sample_count);
+                      bench.run("err::transform_error" + suffix,
+                                [&]
+                                {
+                                    for (std::size_t i = 0; i < sample_count; ++i)
+                                        out[i] = err::transform_error(rotate<N>, expecteds[i]);
+                                    ankerl::nanobench::doNotOptimizeAway(out.data());
+                                });
+                  });
+    report.report(bench);
+}
+
+void transform_error_payload(reporter const& report)
+{
+    using error_type = error_of_size<16>;
+    auto bench       = report.make_bench("transform_error payload");
+    bench.unit("transform_error");
+
+    // The visitor maps error_type onto itself, so the result can be assigned back to the input
+    auto const measure = [&]<typename T>(std::string const& name, std::expected<T, error_type> e)
+    {
+        if constexpr (std::is_copy_constructible_v<T>)
+        {
+            auto       out  = e;
+            auto const copy = [&] { out = err::transform_error(rotate<16>, e); };
+            bench.run("lvalue, " + name + allocations_of(copy),
+                      [&]
+                      {
+                          copy();
+                          ankerl::nanobench::doNotOptimizeAway(out);
+                      });
+        }
+        auto const move = [&] { e = err::transform_error(rotate<16>, std::move(e)); };
+        bench.run("rvalue, " + name + allocations_of(move),
+                  [&]
+                  {
+                      move();
+                      ankerl::nanobench::doNotOptimizeAway(e);
+                  });
+    };
+    measure("std::vector<int>", std::expected<std::vector<int>, error_type>{std::vector<int>(1024)});
+    measure("std::unique_ptr<int>", std::expected<std::unique_ptr<int>, error_type>{std::make_unique<int>(42)});
+    report.report(bench);
+}
+} // namespace err::bench
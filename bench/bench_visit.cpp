@@ -0,0 +1,116 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "bench_errors.hpp"
+#include "bench_switch.hpp"
+#include "benchmarks.hpp"
+
+#include <nanobench.h>
+
+#include <string>
+
+#include <cstddef>
+
+namespace err::bench
+{
+namespace
+{
+constexpr auto visit_weight = [](auto e) { return weight(decltype(e)::possible_values[0]); };
+} // namespace
+
+void visit(reporter const& report)
+{
+    ankerl::nanobench::Rng rng;
+    auto                   bench = report.make_bench("visit");
+    bench.batch(sample_count).unit("visit");
+    for_each_size(error_sizes{},
+                  [&]<std::size_t N>()
+                  {
+                      using error_type  = error_of_size<N>;
+                      auto const errors = random_errors<error_type>(sample_count, rng);
+                      auto const raw    = random_values<N>(sample_count, rng);
+                      auto const suffix = ", " + std::to_string(N) + " enumerators";
+
+                      bench.run("hand-written switch" + suffix,
+                                [&]
+                                {
+                                    unsigned sum = 0;
+                                    for (std::size_t i = 0; i < sample_count; ++i)
+                                        sum += switch_weight<N>(raw[i]);
+                                    ankerl::nanobench::doNotOptimizeAway(sum);
+                                });
+                      bench.run("err::visit" + suffix,
+                                [&]
+                                {
+                                    unsigned sum = 0;
+                                    for (std::size_t i = 0; i < sample_count; ++i)
+                                        sum += errors[i].visit(visit_weight);
+                                    ankerl::nanobench::doNotOptimizeAway(sum);
+                                });
+                  });
+    report.report(bench);
+}
+
+void multi_visit(reporter const& report)
+{
+    // 256x256 would need a table with 65536 entries, which isn't a realistic use case
+    using sizes = std::index_sequence<1, 4, 16, 64>;
+
+    ankerl::nanobench::Rng rng;
+    auto                   bench = report.make_bench("multi visit");
+    bench.batch(sample_count).unit("visit");
+    for_each_size(sizes{},
+                  [&]<std::size_t N>()
+                  {
+                      using error_type  = error_of_size<N>;
+                      auto const lhs    = random_errors<error_type>(sample_count, rng);
+                      auto const rhs    = random_errors<error_type>(sample_count, rng);
+                      auto const suffix = ", 2x" + std::to_string(N) + " enumerators";
+
+                      bench.run("hand-written switch" + suffix,
+                                [&]
+                                {
+                                    unsigned sum = 0;
+                                    for (std::size_t i = 0; i < sample_count; ++i)
+                                    {
+                                        sum += switch_weight<N>(static_cast<bench_enum>(lhs[i]))
+                                               + switch_weight<N>(static_cast<bench_enum>(rhs[i]));
+                                    }
+                                    ankerl::nanobench::doNotOptimizeAway(sum);
+                                });
+                      bench.run("err::visit" + suffix,
+                                [&]
+                                {
+                                    unsigned sum = 0;
+                                    for (std::size_t i = 0; i < sample_count; ++i)
+                                        sum += err::visit(
+                                            [](auto a, auto b) { return visit_weight(a) + visit_weight(b); },
+                                            lhs[i],
+                                            rhs[i]);
+                                    ankerl::nanobench::doNotOptimizeAway(sum);
+                                });
+                  });
+    report.report(bench);
+}
+} // namespace err::bench
@@ -0,0 +1,81 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "bench_errors.hpp"
+#include "benchmarks.hpp"
+#include "err/wire.hpp"
+
+#include <nanobench.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace err::bench
+{
+void wire(reporter const& report)
+{
+    ankerl::nanobench::Rng rng;
+    auto                   bench = report.make_bench("wire encoding");
+    bench.batch(sample_count).unit("error");
+    for_each_size(error_sizes{},
+                  [&]<std::size_t N>()
+                  {
+                      using error_type  = error_of_size<N>;
+                      auto const errors = random_errors<error_type>(sample_count, rng);
+                      auto const raw    = random_values<N>(sample_count, rng);
+                      auto const size   = encoded_size<error_type>(sample_count);
+                      auto const suffix = ", " + std::to_string(N) + " enumerators ("
+                                        + std::to_string(size * sizeof(std::uint64_t)) + " bytes)";
+
+                      std::vector<bench_enum> raw_out(sample_count);
+                      bench.run("copy of raw enums" + suffix,
+                                [&]
+                                {
+                                    std::ranges::copy(raw, raw_out.begin());
+                                    ankerl::nanobench::doNotOptimizeAway(raw_out.data());
+                                });
+
+                      std::vector<std::uint64_t> words(size);
+                      bench.run("err::encode" + suffix,
+                                [&]
+                                {
+                                    ankerl::nanobench::doNotOptimizeAway(encode(errors, words));
+                                    ankerl::nanobench::doNotOptimizeAway(words.data());
+                                });
+
+                      auto decoded = errors;
+                      bench.run("err::decode" + suffix,
+                                [&]
+                                {
+                                    ankerl::nanobench::doNotOptimizeAway(decode(words, decoded).has_value());
+                                    ankerl::nanobench::doNotOptimizeAway(decoded.data());
+                                });
+                  });
+    report.report(bench);
+}
+} // namespace err::bench
@@ -0,0 +1,52 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_BENCHMARKS_HPP
+#define ERR_BENCHMARKS_HPP
+
+#include "reporter.hpp"
+
+namespace err::bench
+{
+void construction(reporter const& report);
+void contract_levels(reporter const& report);
+void conversion(reporter const& report);
+void equality(reporter const& report);
+void hash_lookup(reporter const& report);
+void visit(reporter const& report);
+void multi_visit(reporter const& report);
+void multi_visit_vs_std_visit(reporter const& report);
+void transform(reporter const& report);
+void transform_error(reporter const& report);
+void transform_error_payload(reporter const& report);
+void result_density(reporter const& report);
+void formatting(reporter const& report);
+void wire(reporter const& report);
+void context_chain(reporter const& report);
+void any_error_propagation(reporter const& report);
+void first_error_latch_contention(reporter const& report);
+void collect_and_reduce(reporter const& report);
+} // namespace err::bench
+
+#endif // ERR_BENCHMARKS_HPP
@@ -0,0 +1,106 @@
+#
+# MIT License
+#
+# Copyright (c) 2023 Jan Möller
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+
+# Reads the size of the .text sections of each measured object into a CSV file, split into hot code and cold code
+# (.text.unlikely), together with the size of the read-only data holding the dispatch tables. Prints it, and prints
+# how many bytes each additional error type and visitor adds per strategy.
+#
+# MEASUREMENTS is a |-separated list of <strategy>,<error count>,<visitor count>,<object file>.
+
+string(REPLACE "|" ";" MEASUREMENTS "${MEASUREMENTS}")
+file(WRITE ${OUTPUT} "strategy,errors,visitors,hot_bytes,cold_bytes,table_bytes\n")
+foreach (measurement IN LISTS MEASUREMENTS)
+    string(REPLACE "," ";" fields "${measurement}")
+    list(GET fields 0 strategy)
+    list(GET fields 1 errors)
+    list(GET fields 2 visitors)
+    list(GET fields 3 object)
+
+    execute_process(
+            COMMAND ${SIZE_EXECUTABLE} -A ${object}
+            OUTPUT_VARIABLE sections
+            RESULT_VARIABLE result
+    )
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "${SIZE_EXECUTABLE} failed for ${object}")
+    endif ()
+    string(REPLACE "\n" ";" sections "${sections}")
+    set(hot 0)
+    set(cold 0)
+    set(tables 0)
+    foreach (section IN LISTS sections)
+        if (section MATCHES "^\\.text\\.unlikely[^ \t]*[ \t]+([0-9]+)")
+            math(EXPR cold "${cold} + ${CMAKE_MATCH_1}")
+        elseif (section MATCHES "^\\.text[^ \t]*[ \t]+([0-9]+)")
+            math(EXPR hot "${hot} + ${CMAKE_MATCH_1}")
+        elseif (section MATCHES "^\\.(rodata|data\\.rel\\.ro)[^ \t]*[ \t]+([0-9]+)")
+            math(EXPR tables "${tables} + ${CMAKE_MATCH_2}")
+        endif ()
+    endforeach ()
+
+    file(APPEND ${OUTPUT} "${strategy},${errors},${visitors},${hot},${cold},${tables}\n")
+    set(hot_${strategy}_${errors}_${visitors} ${hot})
+    set(tables_${strategy}_${errors}_${visitors} ${tables})
+    math(EXPR total_${strategy}_${errors}_${visitors} "${hot} + ${cold} + ${tables}")
+    list(APPEND strategies ${strategy})
+    list(APPEND error_counts ${errors})
+    list(APPEND visitor_counts ${visitors})
+endforeach ()
+
+file(READ ${OUTPUT} result)
+message("${result}")
+
+list(REMOVE_DUPLICATES strategies)
+list(REMOVE_DUPLICATES error_counts)
+list(REMOVE_DUPLICATES visitor_counts)
+list(GET error_counts 0 min_errors)
+list(GET error_counts -1 max_errors)
+list(GET visitor_counts 0 min_visitors)
+list(GET visitor_counts -1 max_visitors)
+# Sets <out> to the growth of the <kind> code per step between the given counts, or "-" if there is only one count
+function(growth out kind strategy from_errors from_visitors to_errors to_visitors steps)
+    if (steps GREATER 0)
+        math(EXPR result "(${${kind}_${strategy}_${to_errors}_${to_visitors}} \
+            - ${${kind}_${strategy}_${from_errors}_${from_visitors}}) / ${steps}")
+    else ()
+        set(result "-")
+    endif ()
+    set(${out} ${result} PARENT_SCOPE)
+endfunction()
+
+math(EXPR error_steps "${max_errors} - ${min_errors}")
+math(EXPR visitor_steps "${max_visitors} - ${min_visitors}")
+foreach (strategy IN LISTS strategies)
+    foreach (kind IN ITEMS hot tables total)
+        growth(${kind}_per_error ${kind} ${strategy}
+                ${min_errors} ${max_visitors} ${max_errors} ${max_visitors} ${error_steps})
+        growth(${kind}_per_visitor ${kind} ${strategy}
+                ${max_errors} ${min_visitors} ${max_errors} ${max_visitors} ${visitor_steps})
+    endforeach ()
+    message("${strategy}: "
+            "per error type (${max_visitors} visitors) ${hot_per_error} hot / ${tables_per_error} table / "
+            "${total_per_error} total bytes, "
+            "per visitor (${max_errors} error types) ${hot_per_visitor} hot / ${tables_per_visitor} table / "
+            "${total_per_visitor} total bytes")
+endforeach ()
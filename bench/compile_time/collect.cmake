@@ -0,0 +1,35 @@
+#
+# MIT License
+#
+# Copyright (c) 2023 Jan Möller
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+
+# Concatenates the measurements of all sizes into a single CSV file and prints it
+
+string(REPLACE "," ";" SIZES "${SIZES}")
+file(WRITE ${OUTPUT} "size,seconds,peak_kib\n")
+foreach (size IN LISTS SIZES)
+    file(READ ${INPUT_DIR}/compile_time_${size}.csv measurement)
+    file(APPEND ${OUTPUT} "${measurement}")
+endforeach ()
+
+file(READ ${OUTPUT} result)
+message("${result}")
@@ -0,0 +1,97 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "benchmarks.hpp"
+#include "reporter.hpp"
+
+#include <nanobench.h>
+
+#include <fstream>
+#include <iostream>
+#include <ostream>
+#include <string_view>
+
+#include <cstdlib>
+
+namespace
+{
+void print_usage(char const* program)
+{
+    std::cerr << "usage: " << program << " [--format=markdown|csv|json] [--output=<file>]\n";
+}
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    using err::bench::reporter;
+
+    auto          format = reporter::format::markdown;
+    std::ofstream file;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string_view const arg{argv[i]};
+        if (arg == "--format=markdown")
+            format = reporter::format::markdown;
+        else if (arg == "--format=csv")
+            format = reporter::format::csv;
+        else if (arg == "--format=json")
+            format = reporter::format::json;
+        else if (arg.starts_with("--output="))
+        {
+            file.open(std::string{arg.substr(std::string_view{"--output="}.size())});
+            if (!file)
+            {
+                std::cerr << "cannot open " << arg.substr(std::string_view{"--output="}.size()) << '\n';
+                return EXIT_FAILURE;
+            }
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    reporter const report{format, file.is_open() ? static_cast<std::ostream&>(file) : std::cout};
+    err::bench::construction(report);
+    err::bench::contract_levels(report);
+    err::bench::conversion(report);
+    err::bench::equality(report);
+    err::bench::hash_lookup(report);
+    err::bench::visit(report);
+    err::bench::multi_visit(report);
+    err::bench::multi_visit_vs_std_visit(report);
+    err::bench::transform(report);
+    err::bench::transform_error(report);
+    err::bench::transform_error_payload(report);
+    err::bench::result_density(report);
+    err::bench::formatting(report);
+    err::bench::wire(report);
+    err::bench::context_chain(report);
+    err::bench::any_error_propagation(report);
+    err::bench::first_error_latch_contention(report);
+    err::bench::collect_and_reduce(report);
+    return EXIT_SUCCESS;
+}
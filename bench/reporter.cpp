@@ -0,0 +1,72 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "reporter.hpp"
+
+namespace err::bench
+{
+namespace
+{
+// Same columns as nanobench's csv template, but without the header, so several benchmarks can share one file
+constexpr char const* csv_header = R"("title";"name";"unit";"batch";"elapsed";"error %";"instructions";"branches";"branch misses")"
+                                   "\n";
+constexpr char const* csv_rows
+    = R"({{#result}}"{{title}}";"{{name}}";"{{unit}}";{{batch}};{{median(elapsed)}};{{medianAbsolutePercentError(elapsed)}};{{median(instructions)}};{{median(branchinstructions)}};{{median(branchmisses)}})"
+      "\n{{/result}}";
+
+// One JSON object per line, so several benchmarks can share one file
+constexpr char const* json_lines
+    = R"({{#result}}{"title": "{{title}}", "name": "{{name}}", "unit": "{{unit}}", "batch": {{batch}}, "elapsed": {{median(elapsed)}}, "error %": {{medianAbsolutePercentError(elapsed)}}, "instructions": {{median(instructions)}}, "branches": {{median(branchinstructions)}}, "branch misses": {{median(branchmisses)}}})"
+      "\n{{/result}}";
+} // namespace
+
+reporter::reporter(format fmt, std::ostream& out)
+    : m_format(fmt)
+    , m_out(&out)
+{
+    if (m_format == format::csv)
+        *m_out << csv_header;
+}
+
+auto reporter::make_bench(std::string const& title) const -> ankerl::nanobench::Bench
+{
+    ankerl::nanobench::Bench bench;
+    bench.title(title).relative(true);
+    if (m_format != format::markdown)
+        bench.output(nullptr);
+    else
+        bench.output(m_out);
+    return bench;
+}
+
+void reporter::report(ankerl::nanobench::Bench const& bench) const
+{
+    switch (m_format)
+    {
+    case format::markdown: break; // Already printed while running
+    case format::csv: ankerl::nanobench::render(csv_rows, bench, *m_out); break;
+    case format::json: ankerl::nanobench::render(json_lines, bench, *m_out); break;
+    }
+}
+} // namespace err::bench
@@ -0,0 +1,57 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_BENCH_REPORTER_HPP
+#define ERR_BENCH_REPORTER_HPP
+
+#include <nanobench.h>
+
+#include <ostream>
+#include <string>
+
+namespace err::bench
+{
+// Configures benchmarks and writes their results in the requested format
+class reporter
+{
+  public:
+    enum class format
+    {
+        markdown,
+        csv,
+        json,
+    };
+
+    reporter(format fmt, std::ostream& out);
+
+    [[nodiscard]] auto make_bench(std::string const& title) const -> ankerl::nanobench::Bench;
+    void               report(ankerl::nanobench::Bench const& bench) const;
+
+  private:
+    format        m_format;
+    std::ostream* m_out;
+};
+} // namespace err::bench
+
+#endif // ERR_BENCH_REPORTER_HPP
@@ -0,0 +1,333 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_ALGORITHM_HPP
+#define ERR_ALGORITHM_HPP
+
+#include "err/detail/error_impl.hpp"
+#include "err/first_error_latch.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <exception>
+#include <expected>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+namespace err
+{
+// Elements are processed in order on the calling thread, and processing stops at the first error
+struct sequential_t
+{
+    explicit sequential_t() = default;
+};
+inline constexpr sequential_t sequential{};
+
+// Elements are split into contiguous chunks, which are processed on separate threads. As soon as one chunk fails,
+// the others stop processing. Callables are invoked concurrently, and which error is reported if several elements
+// fail is unspecified.
+struct parallel_t
+{
+    std::size_t thread_count   = 0; // Maximum number of threads, including the calling one; 0 to use all cores
+    std::size_t min_chunk_size = 1024;
+};
+inline constexpr parallel_t parallel{};
+
+namespace detail
+{
+template<typename T>
+concept execution_mode = std::same_as<T, sequential_t> || std::same_as<T, parallel_t>;
+
+template<typename T>
+inline constexpr bool is_expected_of_error_v = false;
+
+template<typename T, auto... Es>
+inline constexpr bool is_expected_of_error_v<std::expected<T, error_impl<Es...>>> = true;
+
+template<typename T>
+concept expected_of_error = is_expected_of_error_v<std::remove_cvref_t<T>>;
+
+template<class F, std::ranges::range R>
+using element_result_t = std::remove_cvref_t<std::invoke_result_t<F&, std::ranges::range_reference_t<R>>>;
+
+// Error of transform_reduce: that of the transformation, combined with that of the reduction if it can fail
+template<class Transformed, class Reduced>
+struct stage_error
+{
+    using type = Transformed::error_type;
+};
+
+template<class Transformed, expected_of_error Reduced>
+struct stage_error<Transformed, Reduced>
+{
+    using type = combined_error<typename Transformed::error_type, typename Reduced::error_type>::type;
+};
+
+template<class Transform, class Reduce, typename T, class R>
+using transform_reduce_error_t
+    = stage_error<element_result_t<Transform, R>, std::remove_cvref_t<std::invoke_result_t<Reduce&, T, T>>>::type;
+
+template<class Error, typename T, class Reduce>
+constexpr auto reduce_step(Reduce& reduce, T&& acc, T&& value) -> std::expected<T, Error>
+{
+    if constexpr (expected_of_error<std::invoke_result_t<Reduce&, T, T>>)
+    {
+        auto result = std::invoke(reduce, std::move(acc), std::move(value));
+        if (!result)
+            return std::unexpected{Error{result.error()}};
+        return *std::move(result);
+    }
+    else
+        return std::invoke(reduce, std::move(acc), std::move(value));
+}
+
+// Number of chunks a range of size elements is split into
+inline auto chunk_count(parallel_t mode, std::size_t size) noexcept -> std::size_t
+{
+    std::size_t const threads = mode.thread_count != 0 ? mode.thread_count
+                                                       : std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    return std::clamp<std::size_t>(size / std::max<std::size_t>(mode.min_chunk_size, 1), 1, threads);
+}
+
+// Calls chunk(i, first, last) for each of the contiguous chunks [first, last) of [0, size) on a separate thread, the
+// first one on the calling thread, and rethrows the exception of the first chunk that threw one
+template<class Chunk>
+void for_each_chunk(std::size_t chunk_count, std::size_t size, Chunk&& chunk)
+{
+    if (chunk_count == 1)
+    {
+        chunk(std::size_t{0}, std::size_t{0}, size);
+        return;
+    }
+
+    std::vector<std::exception_ptr> exceptions(chunk_count);
+    auto const                      run = [&](std::size_t i) noexcept
+    {
+        try
+        {
+            chunk(i, size * i / chunk_count, size * (i + 1) / chunk_count);
+        }
+        catch (...)
+        {
+            exceptions[i] = std::current_exception();
+        }
+    };
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(chunk_count - 1);
+        for (std::size_t i = 1; i < chunk_count; ++i)
+            workers.emplace_back(run, i);
+        run(0);
+    }
+    for (auto const& exception : exceptions)
+    {
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+}
+} // namespace detail
+
+// The values of f applied to all elements of r, or the first error returned by f
+template<std::ranges::input_range R, class F>
+    requires std::invocable<F&, std::ranges::range_reference_t<R>>
+             && detail::expected_of_error<std::invoke_result_t<F&, std::ranges::range_reference_t<R>>>
+auto collect(sequential_t /*mode*/, R&& r, F&& f)
+    -> std::expected<std::vector<typename detail::element_result_t<F, R>::value_type>,
+                     typename detail::element_result_t<F, R>::error_type>
+{
+    std::vector<typename detail::element_result_t<F, R>::value_type> result;
+    if constexpr (std::ranges::sized_range<R>)
+        result.reserve(std::ranges::size(r));
+    for (auto&& element : r)
+    {
+        auto&& e = std::invoke(f, std::forward<decltype(element)>(element));
+        if (!e)
+            return std::unexpected{e.error()};
+        result.push_back(*std::forward<decltype(e)>(e));
+    }
+    return result;
+}
+
+// The values of f applied to all elements of r, or one of the errors returned by f. The result is allocated up front
+// and filled in place by all threads.
+template<std::ranges::random_access_range R, class F>
+    requires std::ranges::sized_range<R> && std::invocable<F&, std::ranges::range_reference_t<R>>
+             && detail::expected_of_error<std::invoke_result_t<F&, std::ranges::range_reference_t<R>>>
+             && std::default_initializable<typename detail::element_result_t<F, R>::value_type>
+             && (!std::same_as<typename detail::element_result_t<F, R>::value_type, bool>)
+auto collect(parallel_t mode, R&& r, F&& f)
+    -> std::expected<std::vector<typename detail::element_result_t<F, R>::value_type>,
+                     typename detail::element_result_t<F, R>::error_type>
+{
+    using error_type = detail::element_result_t<F, R>::error_type;
+
+    auto const                                                       size = std::ranges::size(r);
+    std::vector<typename detail::element_result_t<F, R>::value_type> result(size);
+    first_error_latch<error_type>                                    latch;
+    detail::for_each_chunk(detail::chunk_count(mode, size),
+                           size,
+                           [&](std::size_t /*chunk*/, std::size_t first, std::size_t last)
+                           {
+                               auto it = std::ranges::begin(r) + static_cast<std::ranges::range_difference_t<R>>(first);
+                               for (auto i = first; i < last && !latch.has_error(); ++i, ++it)
+                               {
+                                   auto&& e = std::invoke(f, *it);
+                                   if (!e)
+                                   {
+                                       latch.try_set(e.error());
+                                       return;
+                                   }
+                                   result[i] = *std::forward<decltype(e)>(e);
+                               }
+                           });
+    if (auto const error = latch.load())
+        return std::unexpected{*error};
+    return result;
+}
+
+// The values of all elements of a range of std::expected, or the first error in it
+template<detail::execution_mode Mode, std::ranges::input_range R>
+auto collect(Mode mode, R&& r) -> decltype(collect(mode, std::forward<R>(r), std::identity{}))
+{
+    return collect(mode, std::forward<R>(r), std::identity{});
+}
+
+template<std::ranges::input_range R, class F>
+    requires(!detail::execution_mode<std::remove_cvref_t<R>>)
+auto collect(R&& r, F&& f) -> decltype(collect(sequential, std::forward<R>(r), std::forward<F>(f)))
+{
+    return collect(sequential, std::forward<R>(r), std::forward<F>(f));
+}
+
+template<std::ranges::input_range R>
+auto collect(R&& r) -> decltype(collect(sequential, std::forward<R>(r), std::identity{}))
+{
+    return collect(sequential, std::forward<R>(r), std::identity{});
+}
+
+// Folds the values of transform applied to all elements of r into init using reduce, or returns the first error of
+// either. reduce is called with two Ts, and returns either T or a std::expected of T; the error type of the result
+// combines the error types of transform and reduce.
+template<std::ranges::input_range R, typename T, class Reduce, class Transform>
+    requires std::invocable<Transform&, std::ranges::range_reference_t<R>>
+             && detail::expected_of_error<std::invoke_result_t<Transform&, std::ranges::range_reference_t<R>>>
+             && std::invocable<Reduce&, T, T>
+auto transform_reduce(sequential_t /*mode*/, R&& r, T init, Reduce reduce, Transform transform)
+    -> std::expected<T, detail::transform_reduce_error_t<Transform, Reduce, T, R>>
+{
+    using error_type = detail::transform_reduce_error_t<Transform, Reduce, T, R>;
+
+    for (auto&& element : r)
+    {
+        auto&& e = std::invoke(transform, std::forward<decltype(element)>(element));
+        if (!e)
+            return std::unexpected{error_type{e.error()}};
+        auto next
+            = detail::reduce_step<error_type>(reduce, std::move(init), static_cast<T>(*std::forward<decltype(e)>(e)));
+        if (!next)
+            return std::unexpected{next.error()};
+        init = *std::move(next);
+    }
+    return init;
+}
+
+// Like the sequential transform_reduce, but each chunk is reduced separately, and the results of the chunks are
+// reduced into init in order. reduce must therefore be associative.
+template<std::ranges::random_access_range R, typename T, class Reduce, class Transform>
+    requires std::ranges::sized_range<R> && std::invocable<Transform&, std::ranges::range_reference_t<R>>
+             && detail::expected_of_error<std::invoke_result_t<Transform&, std::ranges::range_reference_t<R>>>
+             && std::invocable<Reduce&, T, T>
+auto transform_reduce(parallel_t mode, R&& r, T init, Reduce reduce, Transform transform)
+    -> std::expected<T, detail::transform_reduce_error_t<Transform, Reduce, T, R>>
+{
+    using error_type = detail::transform_reduce_error_t<Transform, Reduce, T, R>;
+
+    auto const                    size        = std::ranges::size(r);
+    auto const                    chunk_count = detail::chunk_count(mode, size);
+    std::vector<std::optional<T>> partials(chunk_count);
+    first_error_latch<error_type> latch;
+    detail::for_each_chunk(
+        chunk_count,
+        size,
+        [&](std::size_t chunk, std::size_t first, std::size_t last)
+        {
+            std::optional<T> acc;
+            auto             it = std::ranges::begin(r) + static_cast<std::ranges::range_difference_t<R>>(first);
+            for (auto i = first; i < last && !latch.has_error(); ++i, ++it)
+            {
+                auto&& e = std::invoke(transform, *it);
+                if (!e)
+                {
+                    latch.try_set(error_type{e.error()});
+                    return;
+                }
+                auto value = static_cast<T>(*std::forward<decltype(e)>(e));
+                if (!acc)
+                {
+                    acc.emplace(std::move(value));
+                    continue;
+                }
+                auto next = detail::reduce_step<error_type>(reduce, *std::move(acc), std::move(value));
+                if (!next)
+                {
+                    latch.try_set(next.error());
+                    return;
+                }
+                *acc = *std::move(next);
+            }
+            partials[chunk] = std::move(acc);
+        });
+    if (auto const error = latch.load())
+        return std::unexpected{*error};
+
+    for (auto& partial : partials)
+    {
+        if (!partial)
+            continue;
+        auto next = detail::reduce_step<error_type>(reduce, std::move(init), *std::move(partial));
+        if (!next)
+            return std::unexpected{next.error()};
+        init = *std::move(next);
+    }
+    return init;
+}
+
+template<std::ranges::input_range R, typename T, class Reduce, class Transform>
+    requires(!detail::execution_mode<std::remove_cvref_t<R>>)
+auto transform_reduce(R&& r, T init, Reduce reduce, Transform transform)
+    -> decltype(transform_reduce(sequential, std::forward<R>(r), std::move(init), reduce, transform))
+{
+    return transform_reduce(sequential, std::forward<R>(r), std::move(init), std::move(reduce), std::move(transform));
+}
+} // namespace err
+
+#endif // ERR_ALGORITHM_HPP
@@ -0,0 +1,209 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_ANY_ERROR_HPP
+#define ERR_ANY_ERROR_HPP
+
+#include "err/detail/contract_level.hpp"
+#include "err/detail/error_impl.hpp"
+#include "err/detail/index_of.hpp"
+#include "err/detail/push_front.hpp"
+#include "err/detail/type_name.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace err
+{
+// Identifies the enumeration E in an any_error. Derived from the name of E, which is only stable for the same compiler;
+// specialize it to assign fixed ids to enumerations exchanged between binaries built by different compilers.
+// Different enumerations may get the same id, either by a collision of the 32 bit hash or because they have the same
+// name, e.g. in anonymous namespaces of different translation units. any_errors of such enumerations compare equal and
+// convert into each other; audit builds detect this once both enumerations were used with any_error.
+template<typename E>
+    requires std::is_enum_v<E>
+inline constexpr std::uint32_t enum_id_v = []()
+{
+    // FNV-1a over the qualified name of E
+    std::uint32_t hash = 0x811c'9dc5;
+    for (char const c : detail::type_name<E>())
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x0100'0193;
+    }
+    return hash;
+}();
+
+namespace detail
+{
+// Whether value can be stored in the 32 bits any_error reserves for it, such that it is restored unchanged
+template<typename E>
+constexpr auto fits_any_error(E value) noexcept -> bool
+{
+    using underlying = std::underlying_type_t<E>;
+    if constexpr (std::is_signed_v<underlying>)
+        return std::in_range<std::int32_t>(std::to_underlying(value));
+    else
+        return std::in_range<std::uint32_t>(std::to_underlying(value));
+}
+
+struct enum_id_entry
+{
+    std::uint32_t id;
+    enum_id_entry* next = nullptr;
+};
+
+// Every enumeration whose id was checked by enum_id_unique
+inline std::atomic<enum_id_entry*> enum_id_entries{nullptr};
+
+// Whether no other enumeration checked so far has the id of E. Each enumeration registers itself on first use; since
+// both enumerations of a pair register before scanning, at least one of them sees the other even if they race.
+template<typename E>
+auto enum_id_unique() noexcept -> bool
+{
+    static bool const unique = []
+    {
+        static enum_id_entry entry{.id = enum_id_v<E>};
+        push_front(enum_id_entries, &entry);
+        for (auto const* e = enum_id_entries.load(std::memory_order_acquire); e != nullptr; e = e->next)
+            if (e != &entry && e->id == entry.id)
+                return false;
+        return true;
+    }();
+    return unique;
+}
+
+template<class Error>
+inline constexpr bool fits_any_error_v = std::ranges::all_of(Error::possible_values,
+                                                             [](auto value) { return fits_any_error(value); });
+} // namespace detail
+
+// Holds a value of any enumeration used with error, packed into a single 64 bit word together with the id of the
+// enumeration, such that it can cross ABI boundaries where error types can't be named.
+class any_error
+{
+  public:
+    template<auto... Es>
+        requires detail::fits_any_error_v<detail::error_impl<Es...>>
+    constexpr any_error(detail::error_impl<Es...> e) noexcept
+        : m_bits(encode(static_cast<typename detail::error_impl<Es...>::value_type>(e)))
+    {
+        if !consteval
+        {
+            ERR_DETAIL_AUDIT(detail::enum_id_unique<typename detail::error_impl<Es...>::value_type>());
+        }
+    }
+
+    // Restores an any_error previously obtained through bits()
+    static constexpr auto from_bits(std::uint64_t bits) noexcept -> any_error { return any_error{bits}; }
+
+    constexpr auto bits() const noexcept -> std::uint64_t { return m_bits; }
+    constexpr auto type_id() const noexcept -> std::uint32_t { return static_cast<std::uint32_t>(m_bits >> 32); }
+
+    // Whether the contained value is of enumeration E
+    template<typename E>
+        requires std::is_enum_v<E>
+    constexpr auto holds() const noexcept -> bool
+    {
+        if !consteval
+        {
+            ERR_DETAIL_AUDIT(detail::enum_id_unique<E>());
+        }
+        return type_id() == enum_id_v<E>;
+    }
+
+    // The contained value as an Error, or std::nullopt if it is of another enumeration or not in possible_values
+    template<class Error>
+        requires detail::is_error_impl_v<Error>
+    constexpr auto as() const noexcept -> std::optional<Error>
+    {
+        using value_type = Error::value_type;
+        if (!holds<value_type>())
+            return std::nullopt;
+        auto const index = detail::index_of<Error::possible_values>(decode<value_type>());
+        if (index == Error::possible_values.size())
+            return std::nullopt;
+        return Error::from_index(index);
+    }
+
+    friend constexpr auto operator==(any_error lhs, any_error rhs) noexcept -> bool = default;
+
+    template<typename E>
+        requires std::is_enum_v<E>
+    constexpr auto operator==(E other) const noexcept -> bool
+    {
+        if !consteval
+        {
+            ERR_DETAIL_AUDIT(detail::enum_id_unique<E>());
+        }
+        return detail::fits_any_error(other) && m_bits == encode(other);
+    }
+
+  private:
+    constexpr explicit any_error(std::uint64_t bits) noexcept
+        : m_bits(bits)
+    {
+    }
+
+    template<typename E>
+    static constexpr auto encode(E value) noexcept -> std::uint64_t
+    {
+        auto const payload = static_cast<std::uint32_t>(std::to_underlying(value));
+        return std::uint64_t{enum_id_v<E>} << 32 | payload;
+    }
+
+    template<typename E>
+    constexpr auto decode() const noexcept -> E
+    {
+        using underlying   = std::underlying_type_t<E>;
+        auto const payload = static_cast<std::uint32_t>(m_bits);
+        if constexpr (std::is_signed_v<underlying>)
+            return static_cast<E>(static_cast<underlying>(static_cast<std::int32_t>(payload)));
+        else
+            return static_cast<E>(static_cast<underlying>(payload));
+    }
+
+    // Id of the enumeration in the upper 32 bits, value in the lower 32 bits
+    std::uint64_t m_bits;
+};
+} // namespace err
+
+namespace std
+{
+template<>
+struct hash<err::any_error>
+{
+    auto operator()(err::any_error e) const noexcept -> std::size_t { return std::hash<std::uint64_t>{}(e.bits()); }
+};
+} // namespace std
+
+#endif // ERR_ANY_ERROR_HPP
@@ -0,0 +1,247 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_CONTEXT_HPP
+#define ERR_CONTEXT_HPP
+
+#include "err/detail/error_impl.hpp"
+#include "err/error_with.hpp"
+
+#include <atomic>
+#include <iterator>
+#include <source_location>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace err
+{
+// Refers to the innermost frame of a context chain in the context arena of the current thread
+enum class context_handle : std::uint32_t
+{
+    none = 0,
+};
+
+struct context_frame
+{
+    std::string_view     message; // Not copied; must stay valid until the arena is reset, e.g. a string literal
+    std::source_location location;
+};
+
+template<class Error>
+using error_with_context = error_with<Error, context_handle>;
+
+namespace detail
+{
+struct context_node
+{
+    context_frame  frame;
+    context_handle parent;
+};
+
+// Process-wide source of arena epochs. Every arena draws a new epoch when it is created and on every reset, so arenas
+// only share an epoch, and an arena only reuses one, after 2^epoch_bits epochs were drawn in total.
+inline auto next_context_epoch() noexcept -> std::uint32_t
+{
+    static std::atomic<std::uint32_t> epoch{0};
+    return epoch.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Bump allocator for context frames. Handles store the position of a frame in the low index_bits, and the epoch of
+// the arena in the remaining epoch_bits, such that handles that outlived a reset or were passed to another thread are
+// recognized as empty chains. Since epochs wrap around, a handle that outlived 2^epoch_bits epochs may refer to
+// unrelated frames again.
+class context_arena
+{
+  public:
+    static constexpr unsigned      index_bits       = 16;
+    static constexpr unsigned      epoch_bits       = 32 - index_bits;
+    static constexpr std::uint32_t index_mask       = (std::uint32_t{1} << index_bits) - 1;
+    static constexpr std::uint32_t epoch_mask       = (std::uint32_t{1} << epoch_bits) - 1;
+    static constexpr std::size_t   max_frames       = index_mask;
+    static constexpr std::size_t   initial_capacity = 256;
+
+    context_arena() { m_nodes.reserve(initial_capacity); }
+
+    // Frames exceeding max_frames are dropped, so the chain is truncated rather than reporting an error
+    auto push(context_frame const& frame, context_handle parent) -> context_handle
+    {
+        if (m_nodes.size() == max_frames)
+            return parent;
+        m_nodes.push_back(context_node{frame, parent});
+        return static_cast<context_handle>((m_epoch << index_bits) | static_cast<std::uint32_t>(m_nodes.size()));
+    }
+
+    auto find(context_handle handle) const noexcept -> context_node const*
+    {
+        auto const value = std::to_underlying(handle);
+        auto const index = value & index_mask;
+        if (index == 0 || index > m_nodes.size() || (value >> index_bits) != m_epoch)
+            return nullptr;
+        return &m_nodes[index - 1];
+    }
+
+    // Keeps the memory, so that frames of the next request don't allocate
+    void reset() noexcept
+    {
+        m_nodes.clear();
+        m_epoch = next_context_epoch() & epoch_mask;
+    }
+
+    auto size() const noexcept -> std::size_t { return m_nodes.size(); }
+
+  private:
+    std::vector<context_node> m_nodes;
+    std::uint32_t             m_epoch = next_context_epoch() & epoch_mask;
+};
+
+inline auto local_context_arena() -> context_arena&
+{
+    thread_local context_arena arena;
+    return arena;
+}
+} // namespace detail
+
+// Pushes a frame onto the chain starting at parent, and returns the handle of the new chain. message isn't copied, so
+// the string it refers to must outlive the frame, i.e. stay valid until the arena of the thread is reset; string
+// literals always do.
+inline auto push_context(context_handle       parent,
+                         std::string_view     message,
+                         std::source_location location = std::source_location::current()) -> context_handle
+{
+    return detail::local_context_arena().push(context_frame{message, location}, parent);
+}
+
+// Starts a context chain for e. message must stay valid until the arena is reset, see push_context.
+template<auto... Es>
+auto add_context(detail::error_impl<Es...> e,
+                 std::string_view          message,
+                 std::source_location      location = std::source_location::current())
+    -> error_with_context<detail::error_impl<Es...>>
+{
+    return {e, push_context(context_handle::none, message, location)};
+}
+
+// Adds a frame to the context chain of e. message must stay valid until the arena is reset, see push_context.
+template<class Error>
+auto add_context(error_with_context<Error> const& e,
+                 std::string_view                 message,
+                 std::source_location             location = std::source_location::current())
+    -> error_with_context<Error>
+{
+    return {e.error(), push_context(e.payload(), message, location)};
+}
+
+// Drops all frames of the current thread. Handles obtained before are treated as empty chains afterwards.
+inline void reset_context() noexcept
+{
+    detail::local_context_arena().reset();
+}
+
+// Resets the context arena of the current thread when leaving a scope, e.g. at the end of a request
+class context_scope
+{
+  public:
+    context_scope() = default;
+    ~context_scope() { reset_context(); }
+
+    context_scope(context_scope const&)                    = delete;
+    auto operator=(context_scope const&) -> context_scope& = delete;
+};
+
+// The frames of a context chain, starting with the innermost (most recently added) one. The chain must be traversed
+// on the thread that created it, before the arena is reset; otherwise it is empty.
+class context_chain
+{
+  public:
+    class iterator
+    {
+      public:
+        using value_type      = context_frame;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+
+        auto operator*() const noexcept -> context_frame const& { return m_node->frame; }
+        auto operator->() const noexcept -> context_frame const* { return &m_node->frame; }
+
+        auto operator++() noexcept -> iterator&
+        {
+            m_node = m_arena->find(m_node->parent);
+            return *this;
+        }
+        auto operator++(int) noexcept -> iterator
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        friend auto operator==(iterator const& lhs, iterator const& rhs) noexcept -> bool
+        {
+            return lhs.m_node == rhs.m_node;
+        }
+
+      private:
+        friend class context_chain;
+
+        iterator(detail::context_arena const* arena, detail::context_node const* node) noexcept
+            : m_arena(arena)
+            , m_node(node)
+        {
+        }
+
+        detail::context_arena const* m_arena = nullptr;
+        detail::context_node const*  m_node  = nullptr;
+    };
+
+    explicit context_chain(context_handle handle) noexcept
+        : m_handle(handle)
+    {
+    }
+
+    template<class Error>
+    explicit context_chain(error_with_context<Error> const& e) noexcept
+        : m_handle(e.payload())
+    {
+    }
+
+    auto begin() const -> iterator
+    {
+        auto const& arena = detail::local_context_arena();
+        return {&arena, arena.find(m_handle)};
+    }
+    auto end() const noexcept -> iterator { return {}; }
+
+    auto empty() const -> bool { return begin() == end(); }
+
+  private:
+    context_handle m_handle;
+};
+} // namespace err
+
+#endif // ERR_CONTEXT_HPP
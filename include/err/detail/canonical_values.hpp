@@ -0,0 +1,80 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_CANONICAL_VALUES_HPP
+#define ERR_CANONICAL_VALUES_HPP
+
+#include "err/detail/join_arrays.hpp"
+#include "err/detail/sorted_values.hpp"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+#include <cstddef>
+
+namespace err::detail
+{
+// Sorted concatenation of arrays which are sorted themselves. Adjacent arrays are merged pairwise, so each of the
+// log2(sizeof...(Arrs)) rounds takes linear time.
+template<class... Arrs>
+consteval auto merge_sorted(Arrs const&... arrs)
+{
+    auto                                         values = join_arrays<Arrs...>{}(arrs...);
+    std::array<std::size_t, sizeof...(Arrs) + 1> bounds{};
+    std::size_t                                  run = 0;
+    ((bounds[run + 1] = bounds[run] + std::tuple_size_v<Arrs>, ++run), ...);
+
+    auto scratch = values;
+    for (std::size_t width = 1; width < sizeof...(Arrs); width *= 2)
+    {
+        for (std::size_t i = 0; i < sizeof...(Arrs); i += 2 * width)
+        {
+            auto const first = values.begin() + bounds[i];
+            auto const mid   = values.begin() + bounds[std::min(i + width, sizeof...(Arrs))];
+            auto const last  = values.begin() + bounds[std::min(i + 2 * width, sizeof...(Arrs))];
+            std::ranges::merge(first, mid, mid, last, scratch.begin() + bounds[i]);
+        }
+        std::swap(values, scratch);
+    }
+    return values;
+}
+
+// The values of all Arrays, sorted and without duplicates. It is computed once per distinct list of arrays.
+template<auto... Arrays>
+inline constexpr auto canonical_values = []()
+{
+    constexpr auto merged = []()
+    {
+        auto       values = merge_sorted(sorted_values<Arrays>...);
+        auto const size   = std::ranges::unique(values).begin() - values.begin();
+        return std::pair{values, static_cast<std::size_t>(size)};
+    }();
+    std::array<typename decltype(merged.first)::value_type, merged.second> result;
+    std::ranges::copy_n(merged.first.begin(), merged.second, result.begin());
+    return result;
+}();
+} // namespace err::detail
+
+#endif // ERR_CANONICAL_VALUES_HPP
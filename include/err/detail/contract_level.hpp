@@ -0,0 +1,77 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_CONTRACT_LEVEL_HPP
+#define ERR_CONTRACT_LEVEL_HPP
+
+#include <ctrx/contracts.hpp>
+
+// Values of ERR_CONTRACT_LEVEL
+#define ERR_CONTRACT_LEVEL_UNCHECKED 0
+#define ERR_CONTRACT_LEVEL_CHECKED   1
+#define ERR_CONTRACT_LEVEL_AUDIT     2
+
+#ifndef ERR_CONTRACT_LEVEL
+#define ERR_CONTRACT_LEVEL ERR_CONTRACT_LEVEL_CHECKED
+#endif
+
+// The contract level changes the bodies of inline functions, so it must be the same in all translation units of a
+// program. MSVC's linker rejects objects built with different levels.
+#ifdef _MSC_VER
+#if ERR_CONTRACT_LEVEL == ERR_CONTRACT_LEVEL_UNCHECKED
+#pragma detect_mismatch("err_contract_level", "unchecked")
+#elif ERR_CONTRACT_LEVEL == ERR_CONTRACT_LEVEL_CHECKED
+#pragma detect_mismatch("err_contract_level", "checked")
+#else
+#pragma detect_mismatch("err_contract_level", "audit")
+#endif
+#endif
+
+// Preconditions of the interface, e.g. that an error is constructed from one of its possible values. Checked unless
+// the contract level is unchecked.
+#if ERR_CONTRACT_LEVEL >= ERR_CONTRACT_LEVEL_CHECKED
+#define ERR_DETAIL_PRECONDITION(...) CTRX_PRECONDITION(__VA_ARGS__)
+#else
+#define ERR_DETAIL_PRECONDITION(...) static_cast<void>(0)
+#endif
+
+// Invariants that only break if a precondition was violated before, e.g. through the unchecked constructors. Only
+// checked if the contract level is audit.
+#if ERR_CONTRACT_LEVEL >= ERR_CONTRACT_LEVEL_AUDIT
+#define ERR_DETAIL_AUDIT(...) CTRX_ASSERT(__VA_ARGS__)
+#else
+#define ERR_DETAIL_AUDIT(...) static_cast<void>(0)
+#endif
+
+namespace err::detail
+{
+// Selects constructors which don't check their preconditions, regardless of the contract level
+struct unchecked_t
+{
+    explicit unchecked_t() = default;
+};
+inline constexpr unchecked_t unchecked{};
+} // namespace err::detail
+
+#endif // ERR_CONTRACT_LEVEL_HPP
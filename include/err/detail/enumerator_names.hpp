@@ -0,0 +1,90 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_ENUMERATOR_NAMES_HPP
+#define ERR_ENUMERATOR_NAMES_HPP
+
+#include <algorithm>
+#include <array>
+#include <string_view>
+#include <utility>
+
+#include <cstddef>
+
+namespace err::detail
+{
+// Unqualified name of the enumerator V as spelled by the compiler, or an empty string if V doesn't name an enumerator
+template<auto V>
+constexpr auto enumerator_name() noexcept -> std::string_view
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    std::string_view name = __FUNCSIG__;
+    name.remove_prefix(name.find("enumerator_name<") + std::string_view{"enumerator_name<"}.size());
+    name.remove_suffix(name.size() - name.rfind(">(void)"));
+#else
+    std::string_view name = __PRETTY_FUNCTION__;
+    name.remove_prefix(name.find("V = ") + std::string_view{"V = "}.size());
+    name = name.substr(0, name.find_first_of(";]"));
+#endif
+    // Values without an enumerator are printed as a cast or as a plain number
+    if (name.empty() || name.front() == '(' || name.front() == '-' || (name.front() >= '0' && name.front() <= '9'))
+        return {};
+    if (auto const scope = name.rfind("::"); scope != std::string_view::npos)
+        name.remove_prefix(scope + 2);
+    return name;
+}
+
+// Names of all enumerators in Values, stored contiguously
+template<auto Values>
+inline constexpr auto enumerator_names = []<std::size_t... Is>(std::index_sequence<Is...>)
+{
+    constexpr std::size_t size = (enumerator_name<Values[Is]>().size() + ... + 0);
+
+    struct table
+    {
+        std::array<char, size>                     chars{};
+        std::array<std::size_t, Values.size() + 1> offsets{};
+
+        constexpr auto operator[](std::size_t i) const noexcept -> std::string_view
+        {
+            return {chars.data() + offsets[i], offsets[i + 1] - offsets[i]};
+        }
+    } result;
+
+    std::size_t offset = 0;
+    (
+        [&]
+        {
+            constexpr std::string_view name = enumerator_name<Values[Is]>();
+            std::ranges::copy(name, result.chars.begin() + static_cast<std::ptrdiff_t>(offset));
+            result.offsets[Is] = offset;
+            offset += name.size();
+        }(),
+        ...);
+    result.offsets[Values.size()] = offset;
+    return result;
+}(std::make_index_sequence<Values.size()>{});
+} // namespace err::detail
+
+#endif // ERR_ENUMERATOR_NAMES_HPP
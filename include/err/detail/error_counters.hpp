@@ -0,0 +1,148 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_ERROR_COUNTERS_HPP
+#define ERR_ERROR_COUNTERS_HPP
+
+#include "err/detail/enumerator_names.hpp"
+#include "err/detail/push_front.hpp"
+#include "err/detail/type_name.hpp"
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace err::detail
+{
+// Number of times an enumerator was produced
+struct error_count
+{
+    std::string_view type;  // name of the enumeration
+    std::string_view name;  // name of the enumerator, or empty if the value doesn't name an enumerator
+    std::string      value; // underlying value of the enumerator, in decimal
+    std::uint64_t    count;
+
+    friend auto operator==(error_count const&, error_count const&) -> bool = default;
+};
+
+// Type-erased access to the counters of one error type
+struct counter_source
+{
+    void (*collect)(std::vector<error_count>& out);
+    counter_source* next = nullptr;
+};
+
+inline std::atomic<counter_source*> counter_sources{nullptr};
+
+// Not std::hardware_destructive_interference_size: GCC derives it from the tuning flags, so translation units built
+// with different flags would disagree on the layout of the shards
+inline constexpr std::size_t cache_line_size = 64;
+
+// Counters for each possible value of Error, written by at most one thread at a time. Shards are aligned to, and
+// therefore padded to a multiple of, the cache line size, so the shards of different threads never share a line.
+template<class Error>
+struct alignas(cache_line_size) counter_shard
+{
+    std::array<std::atomic<std::uint64_t>, Error::possible_values.size()> counts{};
+    std::atomic<bool>                                                     in_use{true};
+    counter_shard*                                                        next = nullptr;
+};
+
+// All shards of one error type. Shards are handed out to threads, and returned to the pool (keeping their counts) when
+// the thread exits, such that writers never contend and readers never block writers.
+template<class Error>
+struct error_counters
+{
+    static void collect(std::vector<error_count>& out)
+    {
+        std::array<std::uint64_t, Error::possible_values.size()> totals{};
+        for (auto* shard = shards.load(std::memory_order_acquire); shard != nullptr; shard = shard->next)
+        {
+            for (std::size_t i = 0; i < totals.size(); ++i)
+                totals[i] += shard->counts[i].load(std::memory_order_relaxed);
+        }
+        for (std::size_t i = 0; i < totals.size(); ++i)
+        {
+            out.push_back({
+                .type  = type_name<typename Error::value_type>(),
+                .name  = enumerator_names<Error::possible_values>[i],
+                .value = std::to_string(std::to_underlying(Error::possible_values[i])),
+                .count = totals[i],
+            });
+        }
+    }
+
+    static auto acquire() -> counter_shard<Error>*
+    {
+        for (auto* shard = shards.load(std::memory_order_acquire); shard != nullptr; shard = shard->next)
+        {
+            bool expected = false;
+            if (shard->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire))
+                return shard;
+        }
+        auto* shard = new counter_shard<Error>;
+        push_front(shards, shard);
+        if (shard->next == nullptr) // first shard of this error type
+            push_front(counter_sources, &source);
+        return shard;
+    }
+
+    static inline std::atomic<counter_shard<Error>*> shards{nullptr};
+    static inline counter_source                     source{.collect = &collect};
+};
+
+// The shard used by the current thread
+template<class Error>
+struct local_counters
+{
+    local_counters()
+        : shard(error_counters<Error>::acquire())
+    {
+    }
+    local_counters(local_counters const&) = delete;
+    ~local_counters() { shard->in_use.store(false, std::memory_order_release); }
+
+    auto operator=(local_counters const&) -> local_counters& = delete;
+
+    counter_shard<Error>* shard;
+};
+
+template<class Error>
+void count_error(std::size_t index)
+{
+    thread_local local_counters<Error> local;
+
+    // Only this thread writes to the shard, so there is no need for an atomic read-modify-write
+    auto& counter = local.shard->counts[index];
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+} // namespace err::detail
+
+#endif // ERR_ERROR_COUNTERS_HPP
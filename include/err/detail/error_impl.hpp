@@ -27,19 +27,28 @@
 
 #include "err/detail/all_types_same.hpp"
 #include "err/detail/apply_non_type_template_arg.hpp"
+#include "err/detail/canonical_values.hpp"
+#include "err/detail/contract_level.hpp"
+#include "err/detail/enumerator_names.hpp"
 #include "err/detail/first_non_type_template_arg.hpp"
 #include "err/detail/forward_like.hpp"
+#include "err/detail/index_of.hpp"
 #include "err/detail/is_overlap.hpp"
 #include "err/detail/is_subset.hpp"
-#include "err/detail/join_arrays.hpp"
-
-#include <ctrx/contracts.hpp>
+#include "err/detail/record_error.hpp"
+#include "err/detail/smallest_unsigned.hpp"
+#include "err/detail/visit_strategy.hpp"
 
+#include <algorithm>
 #include <array>
+#include <compare>
+#include <concepts>
 #include <expected>
 #include <functional>
+#include <optional>
+#include <string_view>
+#include <tuple>
 #include <utility>
-#include <variant>
 
 namespace err::detail
 {
@@ -48,15 +57,25 @@ template<auto... Enumerators>
             && detail::all_types_same_v<decltype(Enumerators)...> && (std::is_enum_v<decltype(Enumerators)> && ...)
 class error_impl;
 
+struct error_access;
+
 template<class Visitor, auto... Es>
 constexpr auto transform(Visitor&& vis, error_impl<Es...> e) -> decltype(auto);
 
 template<class Visitor, class... Errors>
+    requires(!visit_strategy<std::remove_cvref_t<Visitor>>)
 constexpr auto visit(Visitor&& vis, Errors&&... errors) -> decltype(auto);
 
 template<typename R, class Visitor, class... Errors>
+    requires(!visit_strategy<std::remove_cvref_t<Visitor>>)
 constexpr auto visit(Visitor&& vis, Errors&&... errors) -> decltype(auto);
 
+template<visit_strategy Strategy, class Visitor, class... Errors>
+constexpr auto visit(Strategy strategy, Visitor&& vis, Errors&&... errors) -> decltype(auto);
+
+template<typename R, visit_strategy Strategy, class Visitor, class... Errors>
+constexpr auto visit(Strategy strategy, Visitor&& vis, Errors&&... errors) -> decltype(auto);
+
 template<auto... Enumerators>
     requires(sizeof...(Enumerators) > 0)
             && detail::all_types_same_v<decltype(Enumerators)...> && (std::is_enum_v<decltype(Enumerators)> && ...)
@@ -64,6 +83,7 @@ class error_impl
 {
   public:
     using value_type = std::remove_cvref_t<decltype(detail::first_non_type_template_arg<Enumerators...>())>;
+    using index_type = detail::smallest_unsigned_t<sizeof...(Enumerators) - 1>;
     static constexpr auto possible_values = std::array{Enumerators...};
 
     constexpr error_impl()
@@ -72,46 +92,83 @@ class error_impl
 
     constexpr error_impl() noexcept
         requires(sizeof...(Enumerators) == 1)
-        : m_value(detail::first_non_type_template_arg<Enumerators...>())
+        : m_index(0)
     {
     }
 
     constexpr explicit error_impl(value_type other)
-        : m_value(other)
+        : m_index(encode(detail::index_of<possible_values>(other)))
+    {
+        detail::record_error<error_impl>(m_index);
+    }
+
+    // Like error_impl(other), but doesn't check that other is in possible_values, regardless of the contract level
+    constexpr error_impl(unchecked_t /*tag*/, value_type other) noexcept
+        : m_index(encode_unchecked(detail::index_of<possible_values>(other)))
+    {
+        detail::record_error<error_impl>(m_index);
+    }
+
+    template<value_type... Es>
+        requires(detail::is_overlap_v<std::array{Es...}, possible_values>)
+    constexpr explicit(!detail::is_subset_v<std::array{Es...}, possible_values>)
+        error_impl(error_impl<Es...> other) noexcept(detail::is_subset_v<std::array{Es...}, possible_values>)
+        : m_index(encode(remap(other)))
     {
-        CTRX_PRECONDITION(((other == Enumerators) || ...));
     }
 
+    // Like error_impl(other), but doesn't check that the value of other is in possible_values, regardless of the
+    // contract level
     template<value_type... Es>
-        requires(detail::is_overlap<value_type>({Es...}, {Enumerators...}))
-    constexpr explicit(!detail::is_subset<value_type>({Es...}, {Enumerators...}))
-        error_impl(error_impl<Es...> other) noexcept(detail::is_subset<value_type>({Es...}, {Enumerators...}))
-        : m_value(static_cast<value_type>(other))
+        requires(detail::is_overlap_v<std::array{Es...}, possible_values>)
+    constexpr error_impl(unchecked_t /*tag*/, error_impl<Es...> other) noexcept
+        : m_index(encode_unchecked(remap(other)))
     {
-        CTRX_PRECONDITION(((static_cast<value_type>(other) == Enumerators) || ...));
     }
 
     template<value_type... Es>
-        requires(detail::is_subset<value_type>({Es...}, {Enumerators...}))
+        requires(detail::is_subset_v<std::array{Es...}, possible_values>)
     constexpr auto operator=(error_impl<Es...> other) noexcept -> error_impl&
     {
-        m_value = static_cast<value_type>(other);
+        m_index = static_cast<index_type>(remap(other));
         return *this;
     }
 
     template<value_type... Es>
-        requires(detail::is_overlap<value_type>({Es...}, {Enumerators...}))
+        requires(detail::is_overlap_v<std::array{Es...}, possible_values>)
     constexpr auto operator==(error_impl<Es...> other) const noexcept -> bool
     {
-        return m_value == static_cast<value_type>(other);
+        return m_index == remap(other);
+    }
+    constexpr auto operator==(value_type other) const noexcept -> bool { return value() == other; }
+
+    // Orders by value; for sorted possible_values (as for all errors), this is the order of the positions
+    friend constexpr auto operator<=>(error_impl lhs, error_impl rhs) noexcept
+    {
+        if constexpr (std::ranges::is_sorted(possible_values))
+            return lhs.m_index <=> rhs.m_index;
+        else
+            return possible_values[lhs.m_index] <=> possible_values[rhs.m_index];
+    }
+    constexpr auto operator<=>(value_type other) const noexcept { return value() <=> other; }
+
+    constexpr explicit operator value_type() const noexcept { return value(); }
+
+    // Name of the contained enumerator, or an empty string if the contained value doesn't name an enumerator
+    constexpr auto name() const noexcept -> std::string_view
+    {
+        return detail::enumerator_names<possible_values>[m_index];
     }
-    constexpr auto operator==(value_type other) const noexcept -> bool { return m_value == other; }
 
-    constexpr explicit operator value_type() const noexcept { return m_value; }
+    // Position of the contained value in possible_values
+    constexpr auto index() const noexcept -> std::size_t { return m_index; }
+
+    // The error containing possible_values[index]; index must be less than possible_values.size()
+    static constexpr auto from_index(std::size_t index) -> error_impl { return {from_index_t{}, encode(index)}; }
 
     template<typename T, auto... Es>
-        requires(detail::is_overlap<value_type>({Es...}, {Enumerators...}))
-    constexpr explicit(!detail::is_subset({Enumerators...}, {Es...}))
+        requires(detail::is_overlap_v<std::array{Es...}, possible_values>)
+    constexpr explicit(!detail::is_subset_v<possible_values, std::array{Es...}>)
     operator std::expected<T, error_impl<Es...>>() const
     {
         return std::expected<T, error_impl<Es...>>{std::unexpect, static_cast<error_impl<Es...>>(*this)};
@@ -136,66 +193,351 @@ class error_impl
     }
 
   private:
-    value_type m_value;
+    template<auto... Es>
+        requires(sizeof...(Es) > 0) && detail::all_types_same_v<decltype(Es)...>
+                && (std::is_enum_v<decltype(Es)> && ...)
+    friend class error_impl;
+    friend struct error_access;
+
+    struct from_index_t
+    {
+    };
+
+    constexpr error_impl(from_index_t /*tag*/, index_type index) noexcept
+        : m_index(index)
+    {
+    }
+
+    constexpr auto value() const noexcept -> value_type
+    {
+        ERR_DETAIL_AUDIT(m_index < possible_values.size());
+        return detail::value_at<possible_values>(m_index);
+    }
+
+    static constexpr auto encode(std::size_t index) -> index_type
+    {
+        ERR_DETAIL_PRECONDITION(index < possible_values.size());
+        return static_cast<index_type>(index);
+    }
+
+    // Like encode, but only checks index if the contract level is audit, since it may not fit into index_type
+    static constexpr auto encode_unchecked(std::size_t index) noexcept -> index_type
+    {
+        ERR_DETAIL_AUDIT(index < possible_values.size());
+        return static_cast<index_type>(index);
+    }
+
+    // Position of the value contained in other in possible_values, or possible_values.size() if it isn't contained
+    template<value_type... Es>
+    static constexpr auto remap(error_impl<Es...> other) noexcept -> std::size_t
+    {
+        if constexpr (std::same_as<error_impl<Es...>, error_impl>)
+            return other.m_index;
+        else
+            return detail::index_map<std::array{Es...}, possible_values>[other.m_index];
+    }
+
+    // Position of the contained value in possible_values
+    index_type m_index;
 };
 
-template<auto... Es>
-constexpr auto to_variant(error_impl<Es...> e) -> std::variant<error_impl<Es>...>
+struct error_access
 {
-    std::variant<error_impl<Es>...> var{};
-    using value_type = error_impl<Es...>::value_type;
-    auto fn          = [&e, &var]<value_type E>()
+    template<auto... Es>
+    static constexpr auto index(error_impl<Es...> e) noexcept -> std::size_t
     {
-        if (static_cast<value_type>(e) == E)
-            var = error_impl<E>{};
-    };
-    (fn.template operator()<Es>(), ...);
-    return var;
+        return e.m_index;
+    }
+
+    template<class Error>
+    static constexpr auto from_index(std::size_t index) noexcept -> Error
+    {
+        ERR_DETAIL_AUDIT(index < Error::possible_values.size());
+        return Error{typename Error::from_index_t{}, static_cast<typename Error::index_type>(index)};
+    }
+
+    // Like from_index, but index may exceed possible_values; such errors only serve as niches for other states
+    template<class Error>
+    static constexpr auto with_index(std::size_t index) noexcept -> Error
+    {
+        return Error{typename Error::from_index_t{}, static_cast<typename Error::index_type>(index)};
+    }
+
+    template<class Error, auto... Es>
+    static constexpr auto remap(error_impl<Es...> other) noexcept -> std::size_t
+    {
+        return Error::remap(other);
+    }
+};
+
+template<typename T>
+inline constexpr bool is_error_impl_v = false;
+
+template<auto... Es>
+inline constexpr bool is_error_impl_v<error_impl<Es...>> = true;
+
+// The Error holding value, or std::nullopt if value isn't in Error::possible_values. Always checked, regardless of the
+// contract level.
+template<class Error>
+    requires is_error_impl_v<Error>
+constexpr auto checked_from(typename Error::value_type value) noexcept -> std::optional<Error>
+{
+    auto const index = detail::index_of<Error::possible_values>(value);
+    if (index == Error::possible_values.size())
+        return std::nullopt;
+    detail::record_error<Error>(index);
+    return error_access::from_index<Error>(index);
+}
+
+// other as an Error, or std::nullopt if its value isn't in Error::possible_values
+template<class Error, auto... Es>
+    requires is_error_impl_v<Error> && std::constructible_from<Error, error_impl<Es...>>
+constexpr auto checked_from(error_impl<Es...> other) noexcept -> std::optional<Error>
+{
+    auto const index = error_access::remap<Error>(other);
+    if (index == Error::possible_values.size())
+        return std::nullopt;
+    return error_access::from_index<Error>(index);
+}
+
+// The error containing the values of all Arrays, which is the same type regardless of their order or duplicates
+template<auto... Arrays>
+struct canonical_error
+{
+    using type = detail::apply_non_type_template_arg_t<error_impl, canonical_values<Arrays...>>;
 };
 
 template<typename... Ts>
 struct combined_error
 {
-    consteval static auto remove_duplicates_and_sort()
+    using type = canonical_error<Ts::possible_values...>::type;
+};
+
+template<auto... Es>
+constexpr auto dense_index(error_impl<Es...> e) noexcept -> std::size_t
+{
+    return error_access::index(e);
+}
+
+// The contained value, as the condition of a switch statement. The type is value_type, so -Wswitch expects a case per
+// enumerator of value_type rather than per possible value; exhaustiveness is only checked for errors that list the
+// whole enumeration.
+template<auto... Es>
+constexpr auto match(error_impl<Es...> e) noexcept -> error_impl<Es...>::value_type
+{
+    return static_cast<typename error_impl<Es...>::value_type>(e);
+}
+
+// Splits an offset into the cartesian product of all errors' possible_values into one index per error
+template<std::size_t Flat, class... Errors>
+inline constexpr auto unflatten_index = []()
+{
+    std::array<std::size_t, sizeof...(Errors)> const sizes{Errors::possible_values.size()...};
+    std::array<std::size_t, sizeof...(Errors)>       result{};
+    std::size_t                                      rest = Flat;
+    for (std::size_t i = sizeof...(Errors); i-- > 0;)
     {
-        constexpr auto result = []()
+        result[i] = rest % sizes[i];
+        rest /= sizes[i];
+    }
+    return result;
+}();
+
+template<class... Errors>
+constexpr auto flatten_index(Errors... errors) noexcept -> std::size_t
+{
+    std::size_t offset = 0;
+    ((offset = offset * Errors::possible_values.size() + dense_index(errors)), ...);
+    return offset;
+}
+
+template<std::size_t I, std::size_t Flat, class... Errors>
+using flat_alternative_t = error_impl<std::tuple_element_t<I, std::tuple<Errors...>>::possible_values
+                                          [unflatten_index<Flat, Errors...>[I]]>;
+
+// Calls the visitor with one combination of possible values. It only depends on the types of the alternatives, so
+// visiting different errors that share enumerators with the same visitor shares these functions.
+template<typename R, class Visitor, class... Alternatives>
+constexpr auto visit_thunk(Visitor&& vis) -> R
+{
+    return std::invoke_r<R>(std::forward<Visitor>(vis), Alternatives{}...);
+}
+
+template<typename R, class Visitor, class... Alternatives>
+ERR_DETAIL_OUTLINE constexpr auto cold_visit_thunk(Visitor&& vis) -> R
+{
+    return std::invoke_r<R>(std::forward<Visitor>(vis), Alternatives{}...);
+}
+
+template<std::size_t Flat, class Seq, class... Errors>
+struct flat_alternatives;
+
+template<std::size_t Flat, std::size_t... Is, class... Errors>
+struct flat_alternatives<Flat, std::index_sequence<Is...>, Errors...>
+{
+    template<class Visitor>
+    using invoke_result_t = std::invoke_result_t<Visitor, flat_alternative_t<Is, Flat, Errors...>...>;
+
+    template<typename R, class Visitor>
+    static constexpr auto thunk = &visit_thunk<R, Visitor, flat_alternative_t<Is, Flat, Errors...>...>;
+
+    template<typename R, class Visitor>
+    static constexpr auto cold_thunk = &cold_visit_thunk<R, Visitor, flat_alternative_t<Is, Flat, Errors...>...>;
+};
+
+template<std::size_t Flat, class... Errors>
+using flat_alternatives_t = flat_alternatives<Flat, std::index_sequence_for<Errors...>, Errors...>;
+
+template<class... Errors>
+inline constexpr std::size_t flat_size = (std::size_t{1} * ... * Errors::possible_values.size());
+
+template<class Visitor, class... Errors>
+struct visit_result
+{
+    using type = flat_alternatives_t<0, Errors...>::template invoke_result_t<Visitor>;
+    static_assert(
+        []<std::size_t... Fs>(std::index_sequence<Fs...>)
         {
-            std::array a = join_arrays<decltype(Ts::possible_values)...>{}(Ts::possible_values...);
-            std::ranges::sort(a);
-            auto remove_range = std::ranges::unique(a);
-            return std::make_pair(a, std::distance(a.begin(), remove_range.begin()));
-        }();
-        std::array<typename std::tuple_element<0, decltype(result)>::type::value_type, result.second> r;
-        std::copy(result.first.begin(), result.first.begin() + result.second, r.begin());
-        return r;
-    }
-    using type = detail::apply_non_type_template_arg_t<error_impl, remove_duplicates_and_sort()>;
+            return (std::same_as<type, typename flat_alternatives_t<Fs, Errors...>::template invoke_result_t<Visitor>>
+                    && ...);
+        }(std::make_index_sequence<flat_size<Errors...>>{}),
+        "visitor must return the same type for all combinations of possible values");
 };
 
 template<class Visitor, class... Errors>
+using visit_result_t = visit_result<Visitor, std::remove_cvref_t<Errors>...>::type;
+
+// One entry per combination of possible values, in row-major order. Only the speed strategy instantiates it.
+template<typename R, class Visitor, class... Errors>
+inline constexpr auto visit_table = []<std::size_t... Fs>(std::index_sequence<Fs...>)
+{
+    return std::array<R (*)(Visitor&&), sizeof...(Fs)>{flat_alternatives_t<Fs, Errors...>::template thunk<R, Visitor>...};
+}(std::make_index_sequence<flat_size<Errors...>>{});
+
+// Finds the combination at position flat among [First, Last) by bisection, so there is no table of functions per
+// visitor; only the calls to the shared cold thunks remain.
+template<typename R, class Visitor, std::size_t First, std::size_t Last, class... Errors>
+constexpr auto visit_bisect(Visitor&& vis, std::size_t flat) -> R
+{
+    if constexpr (Last - First == 1)
+        return flat_alternatives_t<First, Errors...>::template cold_thunk<R, Visitor>(std::forward<Visitor>(vis));
+    else
+    {
+        constexpr std::size_t middle = First + (Last - First) / 2;
+        if (flat < middle)
+            return visit_bisect<R, Visitor, First, middle, Errors...>(std::forward<Visitor>(vis), flat);
+        return visit_bisect<R, Visitor, middle, Last, Errors...>(std::forward<Visitor>(vis), flat);
+    }
+}
+
+// The single out-of-line function the size strategy calls per visitor and combination of error types
+template<typename R, class Visitor, class... Errors>
+ERR_DETAIL_OUTLINE constexpr auto visit_trampoline(Visitor&& vis, std::size_t flat) -> R
+{
+    return visit_bisect<R, Visitor, 0, flat_size<Errors...>, Errors...>(std::forward<Visitor>(vis), flat);
+}
+
+// Dispatches on the linearized positions of the contained values in possible_values
+template<typename R, class Visitor, class Strategy, class... Errors>
+constexpr auto visit_dense(Visitor&& vis, Errors... errors) -> R
+{
+    if constexpr (std::same_as<Strategy, optimize_for_size_t>)
+        return visit_trampoline<R, Visitor, Errors...>(std::forward<Visitor>(vis), flatten_index(errors...));
+    else
+        return visit_table<R, Visitor, Errors...>[flatten_index(errors...)](std::forward<Visitor>(vis));
+}
+
+template<class Visitor, class... Errors>
+    requires(!visit_strategy<std::remove_cvref_t<Visitor>>)
 constexpr auto visit(Visitor&& vis, Errors&&... errors) -> decltype(auto)
 {
-    return std::visit(std::forward<Visitor>(vis), to_variant(errors)...);
+    return visit(default_visit_strategy{}, std::forward<Visitor>(vis), std::forward<Errors>(errors)...);
 }
 
 template<typename R, class Visitor, class... Errors>
+    requires(!visit_strategy<std::remove_cvref_t<Visitor>>)
 constexpr auto visit(Visitor&& vis, Errors&&... errors) -> decltype(auto)
 {
-    return std::visit<R>(std::forward<Visitor>(vis), to_variant(errors)...);
+    return visit<R>(default_visit_strategy{}, std::forward<Visitor>(vis), std::forward<Errors>(errors)...);
+}
+
+template<visit_strategy Strategy, class Visitor, class... Errors>
+constexpr auto visit(Strategy /*strategy*/, Visitor&& vis, Errors&&... errors) -> decltype(auto)
+{
+    return visit_dense<visit_result_t<Visitor, Errors...>, Visitor, Strategy, std::remove_cvref_t<Errors>...>(
+        std::forward<Visitor>(vis),
+        errors...);
+}
+
+template<typename R, visit_strategy Strategy, class Visitor, class... Errors>
+constexpr auto visit(Strategy /*strategy*/, Visitor&& vis, Errors&&... errors) -> decltype(auto)
+{
+    return visit_dense<R, Visitor, Strategy, std::remove_cvref_t<Errors>...>(std::forward<Visitor>(vis), errors...);
 }
 
+template<typename R, class Visitor, auto... Es>
+constexpr auto transform_all() -> std::array<R, sizeof...(Es)>
+{
+    std::remove_cvref_t<Visitor> vis{};
+    return {std::invoke_r<R>(static_cast<Visitor&&>(vis), error_impl<Es>{})...};
+}
+
+// Visitors without state whose results can be computed at compile time, such that transform reduces to a table lookup
+template<typename R, class Visitor, auto... Es>
+concept constant_transform = std::is_empty_v<std::remove_cvref_t<Visitor>>
+                             && std::default_initializable<std::remove_cvref_t<Visitor>>
+                             && requires { typename std::bool_constant<(transform_all<R, Visitor, Es...>(), true)>; };
+
+// Result of the transformation of each possible value, in the order of possible_values
+template<typename R, class Visitor, auto... Es>
+inline constexpr auto transform_table = transform_all<R, Visitor, Es...>();
+
 template<class Visitor, auto... Es>
 constexpr auto transform(Visitor&& vis, error_impl<Es...> e) -> decltype(auto)
 {
     using expected_result = typename detail::combined_error<std::invoke_result_t<Visitor, error_impl<Es>>...>::type;
-    return visit<expected_result>(std::forward<Visitor>(vis), e);
+    expected_result result = [&]
+    {
+        if constexpr (constant_transform<expected_result, Visitor, Es...>)
+            return transform_table<expected_result, Visitor, Es...>[dense_index(e)];
+        else
+            return visit<expected_result>(std::forward<Visitor>(vis), e);
+    }();
+    record_error<expected_result>(dense_index(result));
+    return result;
+}
+
+// Forwards e to its transform_error, such that the value is moved if e is an rvalue
+template<class Visitor, class Expected>
+constexpr auto transform_expected_error(Visitor&& vis, Expected&& e) -> decltype(auto)
+{
+    using error_type = std::remove_cvref_t<Expected>::error_type;
+    return std::forward<Expected>(e).transform_error([v = std::forward<Visitor>(vis)](error_type err)
+                                                     { return err.transform(forward_like<Visitor>(v)); });
+}
+
+template<class Visitor, typename T, auto... Es>
+constexpr auto transform_error(Visitor&& vis, std::expected<T, error_impl<Es...>>& e) -> decltype(auto)
+{
+    return transform_expected_error(std::forward<Visitor>(vis), e);
 }
 
 template<class Visitor, typename T, auto... Es>
 constexpr auto transform_error(Visitor&& vis, std::expected<T, error_impl<Es...>> const& e) -> decltype(auto)
 {
-    return e.transform_error([v = std::forward<Visitor>(vis)](error_impl<Es...> err)
-                             { return err.transform(forward_like<Visitor>(v)); });
+    return transform_expected_error(std::forward<Visitor>(vis), e);
+}
+
+template<class Visitor, typename T, auto... Es>
+constexpr auto transform_error(Visitor&& vis, std::expected<T, error_impl<Es...>>&& e) -> decltype(auto)
+{
+    return transform_expected_error(std::forward<Visitor>(vis), std::move(e));
+}
+
+template<class Visitor, typename T, auto... Es>
+constexpr auto transform_error(Visitor&& vis, std::expected<T, error_impl<Es...>> const&& e) -> decltype(auto)
+{
+    return transform_expected_error(std::forward<Visitor>(vis), std::move(e));
 }
 
 } // namespace err::detail
@@ -0,0 +1,297 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_INDEX_OF_HPP
+#define ERR_INDEX_OF_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace err::detail
+{
+// Maps an enumerator to an unsigned integer, such that the distance between two enumerators is preserved (modulo 2^64)
+template<typename E>
+constexpr auto to_unsigned(E e) noexcept -> std::uint64_t
+{
+    return static_cast<std::uint64_t>(std::to_underlying(e));
+}
+
+template<auto Values>
+inline constexpr auto sorted_with_indices = []()
+{
+    std::array<std::pair<typename decltype(Values)::value_type, std::size_t>, Values.size()> result;
+    for (std::size_t i = 0; i < Values.size(); ++i)
+        result[i] = {Values[i], i};
+    std::ranges::sort(result, {}, &decltype(result)::value_type::first);
+    return result;
+}();
+
+// Offset of the largest value from the smallest one
+template<auto Values>
+inline constexpr std::uint64_t value_span = to_unsigned(sorted_with_indices<Values>.back().first)
+                                            - to_unsigned(sorted_with_indices<Values>.front().first);
+
+// Offset of value from the smallest value in Values; larger than value_span for values outside [min, max]
+template<auto Values>
+constexpr auto offset_of(typename decltype(Values)::value_type value) noexcept -> std::uint64_t
+{
+    return to_unsigned(value) - to_unsigned(sorted_with_indices<Values>.front().first);
+}
+
+// How index_of finds the position of a value, depending on how densely Values is distributed
+enum class lookup_strategy
+{
+    contiguous, // offset from the first value
+    bitmask,    // rank in a single 64 bit mask
+    bitmap,     // rank in a bitmap with precomputed word ranks
+    hash,       // two-level perfect hash
+};
+
+template<auto Values>
+inline constexpr auto lookup_strategy_of = []()
+{
+    constexpr std::uint64_t span = value_span<Values>;
+    if (span + 1 == Values.size())
+        return lookup_strategy::contiguous;
+    if (span < 64)
+        return lookup_strategy::bitmask;
+    if (span / 64 < 2 * Values.size())
+        return lookup_strategy::bitmap;
+    return lookup_strategy::hash;
+}();
+
+// Position in Values of the value with the given rank in ascending order
+template<auto Values>
+constexpr auto position_of_rank(std::size_t rank) noexcept -> std::size_t
+{
+    if constexpr (std::ranges::is_sorted(Values))
+        return rank;
+    else
+        return sorted_with_indices<Values>[rank].second;
+}
+
+// One bit per value in [min, max], and the number of values stored in the words before each word
+template<auto Values>
+inline constexpr auto rank_bitmap = []()
+{
+    constexpr std::size_t word_count = value_span<Values> / 64 + 1;
+    struct
+    {
+        std::array<std::uint64_t, word_count> words{};
+        std::array<std::size_t, word_count>   ranks{};
+    } result;
+    for (auto value : Values)
+    {
+        auto const offset = offset_of<Values>(value);
+        result.words[offset / 64] |= std::uint64_t{1} << (offset % 64);
+    }
+    for (std::size_t i = 1; i < word_count; ++i)
+        result.ranks[i] = result.ranks[i - 1] + static_cast<std::size_t>(std::popcount(result.words[i - 1]));
+    return result;
+}();
+
+constexpr auto mix_bits(std::uint64_t x) noexcept -> std::uint64_t
+{
+    x ^= x >> 30;
+    x *= 0xbf58'476d'1ce4'e5b9;
+    x ^= x >> 27;
+    x *= 0x94d0'49bb'1331'11eb;
+    x ^= x >> 31;
+    return x;
+}
+
+// Perfect hash in the "hash and displace" style: values are distributed into buckets by one hash, and each bucket
+// stores a seed for a second hash that places all its values into distinct slots.
+template<auto Values>
+struct perfect_hash
+{
+    static constexpr std::size_t slot_count   = 2 * std::bit_ceil(Values.size());
+    static constexpr std::size_t bucket_count = std::bit_ceil(Values.size());
+    static constexpr std::size_t max_seed     = 0xFFFF;
+    static constexpr int         slot_bits    = std::countr_zero(slot_count);
+
+    struct slot
+    {
+        std::uint64_t key   = 0;
+        std::size_t   index = Values.size();
+    };
+
+    static constexpr auto bucket(std::uint64_t key) noexcept -> std::size_t
+    {
+        return static_cast<std::size_t>(mix_bits(key) & (bucket_count - 1));
+    }
+
+    static constexpr auto slot_of(std::uint64_t key, std::uint16_t seed) noexcept -> std::size_t
+    {
+        return static_cast<std::size_t>(mix_bits(key ^ (seed * 0x9e37'79b9'7f4a'7c15)) >> (64 - slot_bits));
+    }
+
+    bool                                    found = false;
+    std::array<std::uint16_t, bucket_count> seeds{};
+    std::array<slot, slot_count>            slots{};
+};
+
+template<auto Values>
+inline constexpr auto perfect_hash_of = []()
+{
+    using hash = perfect_hash<Values>;
+    hash result;
+
+    // Place the largest buckets first, while there are still many free slots
+    std::array<std::size_t, Values.size()> by_bucket;
+    for (std::size_t i = 0; i < Values.size(); ++i)
+        by_bucket[i] = i;
+    std::array<std::size_t, hash::bucket_count> bucket_sizes{};
+    for (auto value : Values)
+        ++bucket_sizes[hash::bucket(to_unsigned(value))];
+    std::ranges::sort(by_bucket,
+                      [&](std::size_t a, std::size_t b)
+                      {
+                          auto const bucket_a = hash::bucket(to_unsigned(Values[a]));
+                          auto const bucket_b = hash::bucket(to_unsigned(Values[b]));
+                          if (bucket_sizes[bucket_a] != bucket_sizes[bucket_b])
+                              return bucket_sizes[bucket_a] > bucket_sizes[bucket_b];
+                          return bucket_a < bucket_b;
+                      });
+
+    std::array<bool, hash::slot_count> used{};
+    for (std::size_t first = 0; first < Values.size();)
+    {
+        auto const  b    = hash::bucket(to_unsigned(Values[by_bucket[first]]));
+        std::size_t last = first + bucket_sizes[b];
+        std::size_t seed = 0;
+        for (; seed <= hash::max_seed; ++seed)
+        {
+            std::size_t placed = first;
+            for (; placed < last; ++placed)
+            {
+                auto const s = hash::slot_of(to_unsigned(Values[by_bucket[placed]]), static_cast<std::uint16_t>(seed));
+                if (used[s])
+                    break;
+                used[s] = true;
+            }
+            if (placed == last)
+                break;
+            for (std::size_t i = first; i < placed; ++i)
+                used[hash::slot_of(to_unsigned(Values[by_bucket[i]]), static_cast<std::uint16_t>(seed))] = false;
+        }
+        if (seed > hash::max_seed)
+            return result;
+
+        result.seeds[b] = static_cast<std::uint16_t>(seed);
+        for (std::size_t i = first; i < last; ++i)
+        {
+            auto const key = to_unsigned(Values[by_bucket[i]]);
+            result.slots[hash::slot_of(key, result.seeds[b])] = {key, by_bucket[i]};
+        }
+        first = last;
+    }
+    result.found = true;
+    return result;
+}();
+
+// Returns Values[index], computed arithmetically if possible, such that switching over the result needs no table lookup
+template<auto Values>
+constexpr auto value_at(std::size_t index) noexcept -> decltype(Values)::value_type
+{
+    using value_type = decltype(Values)::value_type;
+    if constexpr (lookup_strategy_of<Values> == lookup_strategy::contiguous && std::ranges::is_sorted(Values))
+    {
+        constexpr std::uint64_t first = to_unsigned(Values.front());
+        return static_cast<value_type>(static_cast<std::underlying_type_t<value_type>>(first + index));
+    }
+    else
+        return Values[index];
+}
+
+// Returns the position of value in Values, or Values.size() if it isn't contained
+template<auto Values>
+constexpr auto index_of(typename decltype(Values)::value_type value) noexcept -> std::size_t
+{
+    constexpr auto strategy = lookup_strategy_of<Values>;
+    if constexpr (strategy == lookup_strategy::contiguous)
+    {
+        auto const offset = offset_of<Values>(value);
+        return offset < Values.size() ? position_of_rank<Values>(static_cast<std::size_t>(offset)) : Values.size();
+    }
+    else if constexpr (strategy == lookup_strategy::bitmask)
+    {
+        constexpr std::uint64_t mask   = rank_bitmap<Values>.words[0];
+        auto const              offset = offset_of<Values>(value);
+        if (offset >= 64 || (mask >> offset & 1) == 0)
+            return Values.size();
+        auto const rank = std::popcount(mask & ((std::uint64_t{1} << offset) - 1));
+        return position_of_rank<Values>(static_cast<std::size_t>(rank));
+    }
+    else if constexpr (strategy == lookup_strategy::bitmap)
+    {
+        auto const& bitmap = rank_bitmap<Values>;
+        auto const  offset = offset_of<Values>(value);
+        if (offset > value_span<Values>)
+            return Values.size();
+        auto const word = bitmap.words[offset / 64];
+        auto const bit  = offset % 64;
+        if ((word >> bit & 1) == 0)
+            return Values.size();
+        auto const rank = bitmap.ranks[offset / 64]
+                          + static_cast<std::size_t>(std::popcount(word & ((std::uint64_t{1} << bit) - 1)));
+        return position_of_rank<Values>(rank);
+    }
+    else if constexpr (perfect_hash_of<Values>.found)
+    {
+        using hash       = perfect_hash<Values>;
+        auto const& data = perfect_hash_of<Values>;
+        auto const  key  = to_unsigned(value);
+        auto const& slot = data.slots[hash::slot_of(key, data.seeds[hash::bucket(key)])];
+        return slot.key == key ? slot.index : Values.size();
+    }
+    else
+    {
+        auto const& sorted = sorted_with_indices<Values>;
+        auto const  iter   = std::ranges::lower_bound(sorted,
+                                                   value,
+                                                   {},
+                                                   &std::pair<decltype(value), std::size_t>::first);
+        return iter != sorted.end() && iter->first == value ? iter->second : Values.size();
+    }
+}
+
+// Maps each position in From to the position of the same value in To, or To.size() if To doesn't contain it
+template<auto From, auto To>
+inline constexpr auto index_map = []()
+{
+    std::array<std::size_t, From.size()> result;
+    for (std::size_t i = 0; i < From.size(); ++i)
+        result[i] = index_of<To>(From[i]);
+    return result;
+}();
+} // namespace err::detail
+
+#endif // ERR_INDEX_OF_HPP
@@ -25,16 +25,35 @@
 #ifndef ERR_IS_OVERLAP_HPP
 #define ERR_IS_OVERLAP_HPP
 
-#include <algorithm>
-#include <initializer_list>
+#include "err/detail/sorted_values.hpp"
+
+#include <concepts>
+
+#include <cstddef>
 
 namespace err::detail
 {
-template<typename T>
-consteval auto is_overlap(std::initializer_list<T> a, std::initializer_list<T> b) noexcept -> bool
+// True if A and B have at least one value in common; decided by a single merge pass over the sorted values
+template<auto A, auto B>
+inline constexpr bool is_overlap_v = false;
+
+template<auto A, auto B>
+    requires std::same_as<typename decltype(A)::value_type, typename decltype(B)::value_type>
+inline constexpr bool is_overlap_v<A, B> = []()
 {
-    return std::ranges::any_of(a, [&b](T e) { return std::ranges::contains(b, e); });
-}
+    auto const& a = sorted_values<A>;
+    auto const& b = sorted_values<B>;
+    for (std::size_t i = 0, j = 0; i < a.size() && j < b.size();)
+    {
+        if (a[i] < b[j])
+            ++i;
+        else if (b[j] < a[i])
+            ++j;
+        else
+            return true;
+    }
+    return false;
+}();
 } // namespace err::detail
 
 #endif // ERR_IS_OVERLAP_HPP
@@ -25,16 +25,22 @@
 #ifndef ERR_IS_SUBSET_HPP
 #define ERR_IS_SUBSET_HPP
 
+#include "err/detail/sorted_values.hpp"
+
 #include <algorithm>
-#include <initializer_list>
+#include <concepts>
 
 namespace err::detail
 {
-template<typename T>
-consteval auto is_subset(std::initializer_list<T> subset, std::initializer_list<T> superset) noexcept -> bool
-{
-    return std::ranges::contains_subrange(superset, subset);
-}
+// True if every value in Subset is also contained in Superset; decided by a single merge pass over the sorted values
+template<auto Subset, auto Superset>
+inline constexpr bool is_subset_v = false;
+
+template<auto Subset, auto Superset>
+    requires std::same_as<typename decltype(Subset)::value_type, typename decltype(Superset)::value_type>
+inline constexpr bool is_subset_v<Subset, Superset> = Subset.size() <= Superset.size()
+                                                      && std::ranges::includes(sorted_values<Superset>,
+                                                                               sorted_values<Subset>);
 } // namespace err::detail
 
 #endif // ERR_IS_SUBSET_HPP
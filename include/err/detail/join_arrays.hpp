@@ -25,43 +25,31 @@
 #ifndef ERR_JOIN_ARRAYS_HPP
 #define ERR_JOIN_ARRAYS_HPP
 
+#include "err/detail/all_types_same.hpp"
+
 #include <algorithm>
 #include <array>
-#include <concepts>
+#include <tuple>
 
 namespace err::detail
 {
+// Concatenation of all arrays, in order. The arrays are copied in a single pass rather than joined pairwise, so the
+// depth of constant evaluation doesn't grow with their number.
 template<class... Arrs>
-struct join_arrays;
-
-template<class Arr>
-struct join_arrays<Arr>
+struct join_arrays
 {
-    consteval auto operator()(Arr arr) { return arr; }
-};
+    static_assert(sizeof...(Arrs) > 0);
+    static_assert(all_types_same_v<typename Arrs::value_type...>);
 
-template<class A1, class A2>
-struct join_arrays<A1, A2>
-{
-    consteval auto operator()(A1 a1, A2 a2)
+    consteval auto operator()(Arrs const&... arrs)
     {
-        static_assert(std::same_as<typename A1::value_type, typename A2::value_type>);
-        std::array<typename A1::value_type, a1.size() + a2.size()> result;
-        std::ranges::copy(a1, result.begin());
-        std::ranges::copy(a2, result.begin() + a1.size());
+        using value_type = std::tuple_element_t<0, std::tuple<Arrs...>>::value_type;
+        std::array<value_type, (std::tuple_size_v<Arrs> + ...)> result{};
+        auto out = result.begin();
+        ((out = std::ranges::copy(arrs, out).out), ...);
         return result;
     }
 };
-
-template<class A1, class A2, class... Tail>
-struct join_arrays<A1, A2, Tail...>
-{
-    consteval auto operator()(A1 a1, A2 a2, Tail... tail)
-    {
-        auto res = join_arrays<A1, A2>{}(a1, a2);
-        return join_arrays<decltype(res), Tail...>{}(res, tail...);
-    }
-};
 } // namespace err::detail
 
 #endif // ERR_JOIN_ARRAYS_HPP
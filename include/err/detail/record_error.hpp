@@ -0,0 +1,59 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_RECORD_ERROR_HPP
+#define ERR_RECORD_ERROR_HPP
+
+#ifdef ERR_ENABLE_INSTRUMENTATION
+#include "err/detail/error_counters.hpp"
+#endif
+
+// Like the contract level, instrumentation must be enabled or disabled in all translation units of a program alike
+#ifdef _MSC_VER
+#ifdef ERR_ENABLE_INSTRUMENTATION
+#pragma detect_mismatch("err_instrumentation", "on")
+#else
+#pragma detect_mismatch("err_instrumentation", "off")
+#endif
+#endif
+
+#include <cstddef>
+
+namespace err::detail
+{
+// Counts that an Error holding the value at index in possible_values was produced. Does nothing unless
+// ERR_ENABLE_INSTRUMENTATION is defined, or during constant evaluation.
+template<class Error>
+constexpr void record_error([[maybe_unused]] std::size_t index)
+{
+#ifdef ERR_ENABLE_INSTRUMENTATION
+    if !consteval
+    {
+        count_error<Error>(index);
+    }
+#endif
+}
+} // namespace err::detail
+
+#endif // ERR_RECORD_ERROR_HPP
@@ -0,0 +1,253 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_RESULT_STORAGE_HPP
+#define ERR_RESULT_STORAGE_HPP
+
+#include "err/detail/error_impl.hpp"
+#include "err/detail/smallest_unsigned.hpp"
+
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace err::detail
+{
+// Holds either a T or an error of type E. Since E is stored as its position in E::possible_values, the state of
+// holding a T is encoded as the position one past the end; there is no separate discriminator.
+template<typename T, class E>
+class result_storage
+{
+  public:
+    using state_type = smallest_unsigned_t<E::possible_values.size()>;
+
+    template<class... Args>
+    constexpr explicit result_storage(std::in_place_t /*tag*/, Args&&... args) noexcept(
+        std::is_nothrow_constructible_v<T, Args...>)
+        : m_value(std::forward<Args>(args)...)
+        , m_state(value_state)
+    {
+    }
+
+    constexpr explicit result_storage(E e) noexcept
+        : m_state(static_cast<state_type>(error_access::index(e)))
+    {
+    }
+
+    constexpr result_storage(result_storage const&)
+        requires std::is_trivially_copy_constructible_v<T>
+    = default;
+    constexpr result_storage(result_storage const& other) noexcept(std::is_nothrow_copy_constructible_v<T>)
+        requires(std::is_copy_constructible_v<T> && !std::is_trivially_copy_constructible_v<T>)
+        : m_state(other.m_state)
+    {
+        if (has_value())
+            std::construct_at(std::addressof(m_value), other.m_value);
+    }
+
+    constexpr result_storage(result_storage&&)
+        requires std::is_trivially_move_constructible_v<T>
+    = default;
+    constexpr result_storage(result_storage&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        requires(std::is_move_constructible_v<T> && !std::is_trivially_move_constructible_v<T>)
+        : m_state(other.m_state)
+    {
+        if (has_value())
+            std::construct_at(std::addressof(m_value), std::move(other.m_value));
+    }
+
+    constexpr auto operator=(result_storage const&) -> result_storage&
+        requires(std::is_trivially_copy_assignable_v<T> && std::is_trivially_copy_constructible_v<T>
+                 && std::is_trivially_destructible_v<T>)
+    = default;
+    constexpr auto operator=(result_storage const& other) -> result_storage&
+        requires(std::is_copy_assignable_v<T> && std::is_copy_constructible_v<T>
+                 && !(std::is_trivially_copy_assignable_v<T> && std::is_trivially_copy_constructible_v<T>
+                      && std::is_trivially_destructible_v<T>))
+    {
+        if (other.has_value())
+            assign_value(other.m_value);
+        else
+            assign_state(other.m_state);
+        return *this;
+    }
+
+    constexpr auto operator=(result_storage&&) -> result_storage&
+        requires(std::is_trivially_move_assignable_v<T> && std::is_trivially_move_constructible_v<T>
+                 && std::is_trivially_destructible_v<T>)
+    = default;
+    constexpr auto operator=(result_storage&& other) -> result_storage&
+        requires(std::is_move_assignable_v<T> && std::is_move_constructible_v<T>
+                 && !(std::is_trivially_move_assignable_v<T> && std::is_trivially_move_constructible_v<T>
+                      && std::is_trivially_destructible_v<T>))
+    {
+        if (other.has_value())
+            assign_value(std::move(other.m_value));
+        else
+            assign_state(other.m_state);
+        return *this;
+    }
+
+    constexpr ~result_storage()
+        requires std::is_trivially_destructible_v<T>
+    = default;
+    constexpr ~result_storage()
+    {
+        if (has_value())
+            std::destroy_at(std::addressof(m_value));
+    }
+
+    [[nodiscard]] constexpr auto has_value() const noexcept -> bool { return m_state == value_state; }
+
+    constexpr auto value() & noexcept -> T& { return m_value; }
+    constexpr auto value() const& noexcept -> T const& { return m_value; }
+    constexpr auto value() && noexcept -> T&& { return std::move(m_value); }
+    constexpr auto value() const&& noexcept -> T const&& { return std::move(m_value); }
+
+    constexpr auto error() const noexcept -> E { return error_access::from_index<E>(m_state); }
+
+    template<class U>
+    constexpr void assign_value(U&& value)
+    {
+        if (has_value())
+            m_value = std::forward<U>(value);
+        else
+        {
+            std::construct_at(std::addressof(m_value), std::forward<U>(value));
+            m_state = value_state;
+        }
+    }
+
+    constexpr void assign_error(E e) noexcept { assign_state(static_cast<state_type>(error_access::index(e))); }
+
+  private:
+    static constexpr auto value_state = static_cast<state_type>(E::possible_values.size());
+
+    constexpr void assign_state(state_type state) noexcept
+    {
+        if (has_value())
+            std::destroy_at(std::addressof(m_value));
+        m_state = state;
+    }
+
+    union
+    {
+        T m_value;
+    };
+    state_type m_state;
+};
+
+template<typename T, class E>
+inline constexpr bool has_error_niche_v = false;
+
+// An error only uses the first possible_values.size() values of its index_type; the rest can encode the errors of E
+template<auto... Ts, class E>
+inline constexpr bool has_error_niche_v<error_impl<Ts...>, E> =
+    error_impl<Ts...>::possible_values.size() + E::possible_values.size() - 1
+    <= std::numeric_limits<typename error_impl<Ts...>::index_type>::max();
+
+// Holds either an error T or an error of type E in a single T. Positions past the end of T::possible_values encode the
+// errors of E, so there is neither a separate discriminator nor a separate E.
+template<typename T, class E>
+    requires has_error_niche_v<T, E>
+class result_storage<T, E>
+{
+  public:
+    template<class... Args>
+    constexpr explicit result_storage(std::in_place_t /*tag*/, Args&&... args) noexcept(
+        std::is_nothrow_constructible_v<T, Args...>)
+        : m_value(std::forward<Args>(args)...)
+    {
+    }
+
+    constexpr explicit result_storage(E e) noexcept
+        : m_value(error_access::with_index<T>(value_count + error_access::index(e)))
+    {
+    }
+
+    [[nodiscard]] constexpr auto has_value() const noexcept -> bool
+    {
+        return error_access::index(m_value) < value_count;
+    }
+
+    constexpr auto value() & noexcept -> T& { return m_value; }
+    constexpr auto value() const& noexcept -> T const& { return m_value; }
+    constexpr auto value() && noexcept -> T&& { return std::move(m_value); }
+    constexpr auto value() const&& noexcept -> T const&& { return std::move(m_value); }
+
+    constexpr auto error() const noexcept -> E
+    {
+        return error_access::from_index<E>(error_access::index(m_value) - value_count);
+    }
+
+    template<class U>
+    constexpr void assign_value(U&& value)
+    {
+        m_value = std::forward<U>(value);
+    }
+
+    constexpr void assign_error(E e) noexcept
+    {
+        m_value = error_access::with_index<T>(value_count + error_access::index(e));
+    }
+
+  private:
+    static constexpr auto value_count = T::possible_values.size();
+
+    T m_value;
+};
+
+template<class E>
+class result_storage<void, E>
+{
+  public:
+    using state_type = smallest_unsigned_t<E::possible_values.size()>;
+
+    constexpr explicit result_storage(std::in_place_t /*tag*/) noexcept
+        : m_state(value_state)
+    {
+    }
+
+    constexpr explicit result_storage(E e) noexcept
+        : m_state(static_cast<state_type>(error_access::index(e)))
+    {
+    }
+
+    [[nodiscard]] constexpr auto has_value() const noexcept -> bool { return m_state == value_state; }
+
+    constexpr auto error() const noexcept -> E { return error_access::from_index<E>(m_state); }
+
+    constexpr void assign_value() noexcept { m_state = value_state; }
+
+    constexpr void assign_error(E e) noexcept { m_state = static_cast<state_type>(error_access::index(e)); }
+
+  private:
+    static constexpr auto value_state = static_cast<state_type>(E::possible_values.size());
+
+    state_type m_state;
+};
+} // namespace err::detail
+
+#endif // ERR_RESULT_STORAGE_HPP
@@ -0,0 +1,46 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_SMALLEST_UNSIGNED_HPP
+#define ERR_SMALLEST_UNSIGNED_HPP
+
+#include <limits>
+#include <type_traits>
+
+#include <cstdint>
+
+namespace err::detail
+{
+// The smallest unsigned integer type that can represent all values in [0, Max]
+template<std::uintmax_t Max>
+using smallest_unsigned_t = std::conditional_t<
+    Max <= std::numeric_limits<std::uint8_t>::max(),
+    std::uint8_t,
+    std::conditional_t<
+        Max <= std::numeric_limits<std::uint16_t>::max(),
+        std::uint16_t,
+        std::conditional_t<Max <= std::numeric_limits<std::uint32_t>::max(), std::uint32_t, std::uint64_t>>>;
+} // namespace err::detail
+
+#endif // ERR_SMALLEST_UNSIGNED_HPP
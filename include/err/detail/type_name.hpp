@@ -0,0 +1,54 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_TYPE_NAME_HPP
+#define ERR_TYPE_NAME_HPP
+
+#include <string_view>
+
+namespace err::detail
+{
+// Qualified name of T as spelled by the compiler, e.g. "ns::some_error"
+template<typename T>
+constexpr auto type_name() noexcept -> std::string_view
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    std::string_view name = __FUNCSIG__;
+    name.remove_prefix(name.find("type_name<") + std::string_view{"type_name<"}.size());
+    name.remove_suffix(name.size() - name.rfind(">(void)"));
+    for (std::string_view const keyword : {"enum ", "class ", "struct "})
+    {
+        if (name.starts_with(keyword))
+            name.remove_prefix(keyword.size());
+    }
+    return name;
+#else
+    std::string_view name = __PRETTY_FUNCTION__;
+    name.remove_prefix(name.find("T = ") + std::string_view{"T = "}.size());
+    return name.substr(0, name.find_first_of(";]"));
+#endif
+}
+} // namespace err::detail
+
+#endif // ERR_TYPE_NAME_HPP
@@ -0,0 +1,77 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_VISIT_STRATEGY_HPP
+#define ERR_VISIT_STRATEGY_HPP
+
+#include <concepts>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define ERR_DETAIL_OUTLINE [[gnu::noinline, gnu::cold]]
+#elif defined(_MSC_VER)
+#define ERR_DETAIL_OUTLINE __declspec(noinline)
+#else
+#define ERR_DETAIL_OUTLINE
+#endif
+
+// The default strategy changes the bodies of visit and transform, so it must be the same in all translation units of a
+// program
+#ifdef _MSC_VER
+#ifdef ERR_OPTIMIZE_VISIT_FOR_SIZE
+#pragma detect_mismatch("err_visit_strategy", "size")
+#else
+#pragma detect_mismatch("err_visit_strategy", "speed")
+#endif
+#endif
+
+namespace err::detail
+{
+// Visitation dispatches through a table of functions per combination of error types and visitor, which the compiler
+// may inline the visitor into.
+struct optimize_for_speed_t
+{
+    explicit optimize_for_speed_t() = default;
+};
+inline constexpr optimize_for_speed_t optimize_for_speed{};
+
+// Visitation calls a single out-of-line, cold trampoline per visitor and combination of error types, which bisects
+// instead of using a table, and the functions calling the visitor are cold as well. Visiting adds little code to the
+// caller, no tables, and errors sharing enumerators share the functions calling the visitor.
+struct optimize_for_size_t
+{
+    explicit optimize_for_size_t() = default;
+};
+inline constexpr optimize_for_size_t optimize_for_size{};
+
+#ifdef ERR_OPTIMIZE_VISIT_FOR_SIZE
+using default_visit_strategy = optimize_for_size_t;
+#else
+using default_visit_strategy = optimize_for_speed_t;
+#endif
+
+template<typename T>
+concept visit_strategy = std::same_as<T, optimize_for_speed_t> || std::same_as<T, optimize_for_size_t>;
+} // namespace err::detail
+
+#endif // ERR_VISIT_STRATEGY_HPP
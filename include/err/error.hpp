@@ -28,16 +28,34 @@
 #include "err/detail/all_types_same.hpp"
 #include "err/detail/error_impl.hpp"
 
+#include <array>
+#include <functional>
 #include <type_traits>
 
+#include <cstddef>
+
 namespace err
 {
 template<auto... Enumerators>
     requires detail::all_types_same_v<decltype(Enumerators)...> && (std::is_enum_v<decltype(Enumerators)> && ...)
-using error = detail::combined_error<detail::error_impl<Enumerators>...>::type;
+using error = detail::canonical_error<std::array{Enumerators...}>::type;
+
+// The error type with the fewest possible values that all Errors are closely related to. Unlike folding
+// std::common_type pairwise, all Errors are combined at once, so no intermediate error types are instantiated.
+template<class... Errors>
+    requires(sizeof...(Errors) > 0) && (detail::is_error_impl_v<Errors> && ...)
+using common_error_t = detail::combined_error<Errors...>::type;
 
+using detail::checked_from;
+using detail::match;
+using detail::optimize_for_size;
+using detail::optimize_for_size_t;
+using detail::optimize_for_speed;
+using detail::optimize_for_speed_t;
 using detail::transform;
 using detail::transform_error;
+using detail::unchecked;
+using detail::unchecked_t;
 using detail::visit;
 } // namespace err
 
@@ -48,6 +66,12 @@ struct common_type<err::detail::error_impl<As...>, err::detail::error_impl<Bs...
 {
     using type = err::detail::combined_error<err::detail::error_impl<As...>, err::detail::error_impl<Bs...>>::type;
 };
+
+template<auto... Es>
+struct hash<err::detail::error_impl<Es...>>
+{
+    constexpr auto operator()(err::detail::error_impl<Es...> e) const noexcept -> std::size_t { return e.index(); }
+};
 } // namespace std
 
 #endif // ERR_ERROR_HPP
@@ -0,0 +1,175 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_ERROR_CODE_HPP
+#define ERR_ERROR_CODE_HPP
+
+#include "err/detail/enumerator_names.hpp"
+#include "err/detail/error_impl.hpp"
+#include "err/detail/index_of.hpp"
+#include "err/detail/push_front.hpp"
+#include "err/detail/type_name.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+
+namespace err
+{
+namespace detail
+{
+// Looks up the names of the enumerators that one error type lists
+template<typename E>
+struct enum_name_source
+{
+    auto (*name)(E value) noexcept -> std::string_view;
+    enum_name_source* next = nullptr;
+};
+
+// All error types of value type E that were converted to std::error_code
+template<typename E>
+constinit inline std::atomic<enum_name_source<E>*> enum_name_sources{nullptr};
+
+template<class Error>
+struct enum_name_registration
+{
+    using value_type = Error::value_type;
+
+    static auto name(value_type value) noexcept -> std::string_view
+    {
+        auto const index = index_of<Error::possible_values>(value);
+        if (index == Error::possible_values.size())
+            return {};
+        return enumerator_names<Error::possible_values>[index];
+    }
+
+    enum_name_registration() noexcept { push_front(enum_name_sources<value_type>, &source); }
+
+    enum_name_source<value_type> source{.name = &name};
+};
+
+// Registered during dynamic initialization, such that converting an error to std::error_code costs nothing extra
+template<class Error>
+inline enum_name_registration<Error> enum_names_of{};
+
+// Null-terminated, as required by std::error_category::name()
+template<typename E>
+inline constexpr auto category_name = []()
+{
+    constexpr std::string_view name = type_name<E>();
+    std::array<char, name.size() + 1> result{};
+    std::ranges::copy(name, result.begin());
+    return result;
+}();
+
+template<typename E>
+class enum_category_impl final : public std::error_category
+{
+  public:
+    constexpr enum_category_impl() noexcept = default;
+
+    auto name() const noexcept -> char const* override { return category_name<E>.data(); }
+
+    // The name of the enumerator, if any error type listing it was converted to std::error_code
+    auto message(int value) const -> std::string override
+    {
+        if (std::in_range<std::underlying_type_t<E>>(value))
+        {
+            auto const enumerator = static_cast<E>(value);
+            for (auto* source = enum_name_sources<E>.load(std::memory_order_acquire); source != nullptr;
+                 source       = source->next)
+            {
+                if (auto const name = source->name(enumerator); !name.empty())
+                    return std::string{name};
+            }
+        }
+        return "unknown " + std::string{type_name<E>()} + " value " + std::to_string(value);
+    }
+};
+
+template<typename E>
+constinit inline enum_category_impl<E> const enum_category_instance{};
+
+template<class Error>
+inline constexpr bool fits_error_code_v = std::ranges::all_of(
+    Error::possible_values,
+    [](auto value) { return std::in_range<int>(std::to_underlying(value)); });
+
+// Found by argument-dependent lookup from the constructor of std::error_code
+template<auto... Es>
+    requires fits_error_code_v<error_impl<Es...>>
+auto make_error_code(error_impl<Es...> e) noexcept -> std::error_code
+{
+    using value_type = error_impl<Es...>::value_type;
+    static_cast<void>(&enum_names_of<error_impl<Es...>>);
+    return std::error_code{static_cast<int>(std::to_underlying(static_cast<value_type>(e))),
+                           enum_category_instance<value_type>};
+}
+} // namespace detail
+
+// The std::error_category of error_codes holding an enumerator of E; there is exactly one per enumeration
+template<typename E>
+    requires std::is_enum_v<E>
+auto enum_category() noexcept -> std::error_category const&
+{
+    return detail::enum_category_instance<E>;
+}
+
+using detail::make_error_code;
+
+// The value of ec as an Error, or std::nullopt if ec isn't of enum_category<Error::value_type>() or its value isn't in
+// Error::possible_values
+template<class Error>
+    requires detail::is_error_impl_v<Error>
+auto from_error_code(std::error_code const& ec) noexcept -> std::optional<Error>
+{
+    using value_type = Error::value_type;
+    using underlying = std::underlying_type_t<value_type>;
+    if (ec.category() != enum_category<value_type>() || !std::in_range<underlying>(ec.value()))
+        return std::nullopt;
+    auto const index = detail::index_of<Error::possible_values>(static_cast<value_type>(ec.value()));
+    if (index == Error::possible_values.size())
+        return std::nullopt;
+    return Error::from_index(index);
+}
+} // namespace err
+
+namespace std
+{
+template<auto... Es>
+struct is_error_code_enum<err::detail::error_impl<Es...>>
+    : bool_constant<err::detail::fits_error_code_v<err::detail::error_impl<Es...>>>
+{
+};
+} // namespace std
+
+#endif // ERR_ERROR_CODE_HPP
@@ -0,0 +1,159 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_ERROR_MAP_HPP
+#define ERR_ERROR_MAP_HPP
+
+#include "err/detail/error_impl.hpp"
+
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+
+namespace err
+{
+// Associates a value with every possible value of Error, stored contiguously in the order of possible_values
+template<class Error, typename T>
+    requires detail::is_error_impl_v<Error>
+class error_map
+{
+    template<bool Const>
+    class basic_iterator;
+
+  public:
+    using key_type       = Error;
+    using mapped_type    = T;
+    using iterator       = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    static constexpr auto keys = Error::possible_values;
+
+    constexpr error_map() = default;
+
+    // Initializes the value of each key e with vis(error<e>{})
+    template<class Visitor>
+        requires(!std::same_as<std::remove_cvref_t<Visitor>, error_map>)
+    constexpr explicit error_map(Visitor&& vis)
+        : m_values(make_values(vis, std::make_index_sequence<keys.size()>{}))
+    {
+    }
+
+    constexpr auto operator[](Error e) noexcept -> T& { return m_values[e.index()]; }
+    constexpr auto operator[](Error e) const noexcept -> T const& { return m_values[e.index()]; }
+
+    static constexpr auto size() noexcept -> std::size_t { return keys.size(); }
+
+    constexpr auto values() noexcept -> std::span<T, keys.size()> { return m_values; }
+    constexpr auto values() const noexcept -> std::span<T const, keys.size()> { return m_values; }
+
+    constexpr auto begin() noexcept -> iterator { return iterator{m_values.data(), 0}; }
+    constexpr auto begin() const noexcept -> const_iterator { return const_iterator{m_values.data(), 0}; }
+    constexpr auto end() noexcept -> iterator { return iterator{m_values.data(), keys.size()}; }
+    constexpr auto end() const noexcept -> const_iterator { return const_iterator{m_values.data(), keys.size()}; }
+
+  private:
+    template<class Visitor, std::size_t... Is>
+    static constexpr auto make_values(Visitor& vis, std::index_sequence<Is...> /*indices*/)
+        -> std::array<T, keys.size()>
+    {
+        return {std::invoke_r<T>(vis, detail::error_impl<keys[Is]>{})...};
+    }
+
+    std::array<T, keys.size()> m_values{};
+};
+
+// Yields pairs of an error and a reference to its value
+template<class Error, typename T>
+    requires detail::is_error_impl_v<Error>
+template<bool Const>
+class error_map<Error, T>::basic_iterator
+{
+    using mapped_reference = std::conditional_t<Const, T const&, T&>;
+
+  public:
+    using iterator_concept = std::forward_iterator_tag;
+    using value_type       = std::pair<Error, mapped_reference>;
+    using difference_type  = std::ptrdiff_t;
+
+    constexpr basic_iterator() = default;
+
+    template<bool OtherConst>
+        requires(Const && !OtherConst)
+    constexpr basic_iterator(basic_iterator<OtherConst> const& other) noexcept
+        : m_values(other.m_values)
+        , m_index(other.m_index)
+    {
+    }
+
+    constexpr auto operator*() const noexcept -> value_type
+    {
+        return {Error::from_index(m_index), m_values[m_index]};
+    }
+
+    constexpr auto operator++() noexcept -> basic_iterator&
+    {
+        ++m_index;
+        return *this;
+    }
+    constexpr auto operator++(int) noexcept -> basic_iterator
+    {
+        auto copy = *this;
+        ++m_index;
+        return copy;
+    }
+
+    friend constexpr auto operator==(basic_iterator const& lhs, basic_iterator const& rhs) noexcept -> bool
+    {
+        return lhs.m_index == rhs.m_index;
+    }
+
+  private:
+    friend class error_map;
+    friend class basic_iterator<!Const>;
+
+    using pointer = std::conditional_t<Const, T const*, T*>;
+
+    constexpr basic_iterator(pointer values, std::size_t index) noexcept
+        : m_values(values)
+        , m_index(index)
+    {
+    }
+
+    pointer     m_values = nullptr;
+    std::size_t m_index  = 0;
+};
+
+// Values can be updated concurrently, e.g. to count errors from multiple threads
+template<class Error, typename T>
+using atomic_error_map = error_map<Error, std::atomic<T>>;
+} // namespace err
+
+#endif // ERR_ERROR_MAP_HPP
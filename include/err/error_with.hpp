@@ -0,0 +1,192 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_ERROR_WITH_HPP
+#define ERR_ERROR_WITH_HPP
+
+#include "err/detail/error_impl.hpp"
+#include "err/error.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <expected>
+#include <type_traits>
+#include <utility>
+
+namespace err
+{
+// Upper bound for the size of payloads attached to an error, such that error_with stays cheap to copy around
+inline constexpr std::size_t max_payload_size = 64;
+
+template<class Error, typename Payload>
+    requires detail::is_error_impl_v<Error> && std::is_trivially_copyable_v<Payload>
+             && (!std::is_const_v<Payload>) && (sizeof(Payload) <= max_payload_size)
+class error_with;
+
+namespace detail
+{
+template<typename T>
+inline constexpr bool is_error_with_v = false;
+
+template<class Error, typename Payload>
+inline constexpr bool is_error_with_v<error_with<Error, Payload>> = true;
+} // namespace detail
+
+template<class Error, typename Payload>
+    requires detail::is_error_impl_v<Error> && std::is_trivially_copyable_v<Payload>
+             && (!std::is_const_v<Payload>) && (sizeof(Payload) <= max_payload_size)
+class error_with
+{
+  public:
+    using error_type   = Error;
+    using payload_type = Payload;
+    using value_type   = Error::value_type;
+    static constexpr auto possible_values = Error::possible_values;
+
+    constexpr explicit error_with(value_type value, Payload const& payload)
+        : m_error(value)
+        , m_payload(payload)
+    {
+    }
+
+    template<class E>
+        requires detail::is_error_impl_v<E> && std::constructible_from<Error, E>
+    constexpr explicit(!std::is_convertible_v<E, Error>) error_with(E e, Payload const& payload)
+        noexcept(std::is_nothrow_constructible_v<Error, E>)
+        : m_error(e)
+        , m_payload(payload)
+    {
+    }
+
+    template<class E>
+        requires(!std::same_as<E, Error>) && std::constructible_from<Error, E>
+    constexpr explicit(!std::is_convertible_v<E, Error>) error_with(error_with<E, Payload> const& other)
+        noexcept(std::is_nothrow_constructible_v<Error, E>)
+        : m_error(other.error())
+        , m_payload(other.payload())
+    {
+    }
+
+    template<class E>
+        requires(!std::same_as<E, Error>) && std::is_assignable_v<Error&, E>
+    constexpr auto operator=(error_with<E, Payload> const& other) noexcept -> error_with&
+    {
+        m_error   = other.error();
+        m_payload = other.payload();
+        return *this;
+    }
+
+    // Compares both error and payload
+    friend constexpr auto operator==(error_with const& lhs, error_with const& rhs) -> bool = default;
+
+    // Compares only the error, ignoring the payload
+    template<auto... Es>
+        requires requires(Error const& e, detail::error_impl<Es...> other) { e == other; }
+    constexpr auto operator==(detail::error_impl<Es...> other) const noexcept -> bool
+    {
+        return m_error == other;
+    }
+    constexpr auto operator==(value_type other) const noexcept -> bool { return m_error == other; }
+
+    constexpr explicit operator value_type() const noexcept { return static_cast<value_type>(m_error); }
+
+    constexpr auto error() const noexcept -> Error { return m_error; }
+
+    constexpr auto payload() noexcept -> Payload& { return m_payload; }
+    constexpr auto payload() const noexcept -> Payload const& { return m_payload; }
+
+    constexpr auto name() const noexcept -> std::string_view { return m_error.name(); }
+
+    template<typename T, class E>
+        requires std::constructible_from<error_with<E, Payload>, error_with>
+    constexpr explicit(!std::is_convertible_v<error_with, error_with<E, Payload>>)
+    operator std::expected<T, error_with<E, Payload>>() const
+    {
+        return std::expected<T, error_with<E, Payload>>{std::unexpect, static_cast<error_with<E, Payload>>(*this)};
+    }
+
+    // Transforms the error, and attaches the payload to the result
+    template<class Visitor>
+    constexpr auto transform(Visitor&& vis) const
+    {
+        using transformed_error = decltype(m_error.transform(std::forward<Visitor>(vis)));
+        return error_with<transformed_error, Payload>{m_error.transform(std::forward<Visitor>(vis)), m_payload};
+    }
+
+    // Visits the error; the payload is available through payload()
+    template<class Visitor>
+    constexpr auto visit(Visitor&& vis) const -> decltype(auto)
+    {
+        return m_error.visit(std::forward<Visitor>(vis));
+    }
+
+    template<typename R, class Visitor>
+    constexpr auto visit(Visitor&& vis) const -> decltype(auto)
+    {
+        return m_error.template visit<R>(std::forward<Visitor>(vis));
+    }
+
+  private:
+    Error   m_error;
+    Payload m_payload;
+};
+
+// Transforms the error of e, keeping the payload, as for expected<T, error<Es...>>
+template<class Visitor, typename T, class Error, typename Payload>
+constexpr auto transform_error(Visitor&& vis, std::expected<T, error_with<Error, Payload>>& e) -> decltype(auto)
+{
+    return detail::transform_expected_error(std::forward<Visitor>(vis), e);
+}
+
+template<class Visitor, typename T, class Error, typename Payload>
+constexpr auto transform_error(Visitor&& vis, std::expected<T, error_with<Error, Payload>> const& e) -> decltype(auto)
+{
+    return detail::transform_expected_error(std::forward<Visitor>(vis), e);
+}
+
+template<class Visitor, typename T, class Error, typename Payload>
+constexpr auto transform_error(Visitor&& vis, std::expected<T, error_with<Error, Payload>>&& e) -> decltype(auto)
+{
+    return detail::transform_expected_error(std::forward<Visitor>(vis), std::move(e));
+}
+
+template<class Visitor, typename T, class Error, typename Payload>
+constexpr auto transform_error(Visitor&& vis, std::expected<T, error_with<Error, Payload>> const&& e) -> decltype(auto)
+{
+    return detail::transform_expected_error(std::forward<Visitor>(vis), std::move(e));
+}
+} // namespace err
+
+namespace std
+{
+template<auto... As, auto... Bs, typename Payload>
+struct common_type<err::error_with<err::detail::error_impl<As...>, Payload>,
+                   err::error_with<err::detail::error_impl<Bs...>, Payload>>
+{
+    using type
+        = err::error_with<common_type_t<err::detail::error_impl<As...>, err::detail::error_impl<Bs...>>, Payload>;
+};
+} // namespace std
+
+#endif // ERR_ERROR_WITH_HPP
@@ -0,0 +1,110 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_FIRST_ERROR_LATCH_HPP
+#define ERR_FIRST_ERROR_LATCH_HPP
+
+#include "err/detail/error_impl.hpp"
+#include "err/detail/smallest_unsigned.hpp"
+
+#include <atomic>
+#include <optional>
+#include <stop_token>
+
+namespace err
+{
+// Holds the first error stored into it by any thread, e.g. the first failure of a group of parallel tasks. All
+// operations are lock-free; only wait() blocks.
+template<class Error>
+    requires detail::is_error_impl_v<Error>
+class first_error_latch
+{
+  public:
+    using error_type = Error;
+
+    constexpr first_error_latch() noexcept = default;
+
+    first_error_latch(first_error_latch const&)                    = delete;
+    auto operator=(first_error_latch const&) -> first_error_latch& = delete;
+
+    // Stores e if no error has been stored yet, and returns whether it did
+    auto try_set(Error e) noexcept -> bool
+    {
+        // Once an error is stored, losing threads only read the shared cache line instead of writing it
+        if (m_state.load(std::memory_order_relaxed) != empty)
+            return false;
+        state_type expected = empty;
+        if (!m_state.compare_exchange_strong(expected, encode(e), std::memory_order_release, std::memory_order_relaxed))
+            return false;
+        m_state.notify_all();
+        return true;
+    }
+
+    // Like try_set(e), but additionally requests stop on stop if e is the first error, so that the remaining tasks of
+    // the group can abort early
+    auto try_set(Error e, std::stop_source& stop) noexcept -> bool
+    {
+        if (!try_set(e))
+            return false;
+        stop.request_stop();
+        return true;
+    }
+
+    // Whether an error has been stored
+    auto has_error() const noexcept -> bool { return m_state.load(std::memory_order_acquire) != empty; }
+
+    // The stored error, or std::nullopt if none has been stored yet
+    auto load() const noexcept -> std::optional<Error>
+    {
+        auto const state = m_state.load(std::memory_order_acquire);
+        if (state == empty)
+            return std::nullopt;
+        return decode(state);
+    }
+
+    // Blocks until an error is stored, and returns it
+    auto wait() const noexcept -> Error
+    {
+        m_state.wait(empty, std::memory_order_acquire);
+        return decode(m_state.load(std::memory_order_acquire));
+    }
+
+    // Forgets the stored error. Must not be called concurrently with other operations.
+    void reset() noexcept { m_state.store(empty, std::memory_order_relaxed); }
+
+  private:
+    // Position of the stored value in Error::possible_values plus one, or empty
+    using state_type = detail::smallest_unsigned_t<Error::possible_values.size()>;
+    static_assert(std::atomic<state_type>::is_always_lock_free);
+
+    static constexpr state_type empty = 0;
+
+    static constexpr auto encode(Error e) noexcept -> state_type { return static_cast<state_type>(e.index() + 1); }
+    static constexpr auto decode(state_type state) noexcept -> Error { return Error::from_index(state - 1); }
+
+    std::atomic<state_type> m_state{empty};
+};
+} // namespace err
+
+#endif // ERR_FIRST_ERROR_LATCH_HPP
@@ -0,0 +1,58 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_FORMAT_HPP
+#define ERR_FORMAT_HPP
+
+#include "err/detail/error_impl.hpp"
+
+#include <array>
+#include <charconv>
+#include <format>
+#include <string_view>
+#include <utility>
+
+namespace std
+{
+// Formats an error as the name of its enumerator, or as its underlying value if the value doesn't name an enumerator.
+// Accepts the same format specification as std::string_view.
+template<auto... Es>
+struct formatter<err::detail::error_impl<Es...>, char> : formatter<string_view, char>
+{
+    template<class FormatContext>
+    auto format(err::detail::error_impl<Es...> e, FormatContext& ctx) const -> typename FormatContext::iterator
+    {
+        if (auto const name = e.name(); !name.empty())
+            return formatter<string_view, char>::format(name, ctx);
+
+        // Enough for the sign and all digits of a 64 bit integer
+        array<char, 21> buffer;
+        auto const      value  = to_underlying(static_cast<typename err::detail::error_impl<Es...>::value_type>(e));
+        auto const      result = to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+        return formatter<string_view, char>::format(string_view{buffer.data(), result.ptr}, ctx);
+    }
+};
+} // namespace std
+
+#endif // ERR_FORMAT_HPP
@@ -0,0 +1,109 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_INSTRUMENTATION_HPP
+#define ERR_INSTRUMENTATION_HPP
+
+#include "err/detail/error_counters.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <ostream>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace err
+{
+using detail::error_count;
+
+// Number of times each enumerator was produced, summed over all threads and error types. Enumerators that were never
+// produced by an error type that was produced at least once are reported with a count of zero.
+inline auto error_counts() -> std::vector<error_count>
+{
+    std::vector<error_count> counts;
+    for (auto* source = detail::counter_sources.load(std::memory_order_acquire); source != nullptr;
+         source       = source->next)
+        source->collect(counts);
+
+    auto const key = [](error_count const& c) { return std::tie(c.type, c.value); };
+    std::ranges::sort(counts, {}, key);
+    std::vector<error_count> merged;
+    for (auto& c : counts)
+    {
+        if (!merged.empty() && key(merged.back()) == key(c))
+            merged.back().count += c.count;
+        else
+            merged.push_back(std::move(c));
+    }
+    return merged;
+}
+
+// Writes counts in the Prometheus text exposition format. The value label is the name of the enumerator, or its value
+// if it has no name.
+inline auto write_prometheus(std::ostream& os, std::vector<error_count> const& counts) -> std::ostream&
+{
+    auto const escaped = [&os](std::string_view label) -> std::ostream&
+    {
+        for (char const c : label)
+        {
+            if (c == '\\' || c == '"')
+                os << '\\' << c;
+            else if (c == '\n')
+                os << "\\n";
+            else
+                os << c;
+        }
+        return os;
+    };
+
+    os << "# HELP err_errors_total Number of errors produced, by enumerator.\n";
+    os << "# TYPE err_errors_total counter\n";
+    for (auto const& c : counts)
+    {
+        os << "err_errors_total{type=\"";
+        escaped(c.type) << "\",value=\"";
+        escaped(c.name.empty() ? std::string_view{c.value} : c.name) << "\"} " << c.count << '\n';
+    }
+    return os;
+}
+
+// Writes the current counts to the file at path, e.g. for the textfile collector of the node exporter. The file is
+// replaced atomically, so readers never observe a partially written file.
+inline void write_prometheus(std::filesystem::path const& path)
+{
+    auto temporary = path;
+    temporary += ".tmp";
+    {
+        std::ofstream file;
+        file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+        file.open(temporary);
+        write_prometheus(file, error_counts());
+    }
+    std::filesystem::rename(temporary, path);
+}
+} // namespace err
+
+#endif // ERR_INSTRUMENTATION_HPP
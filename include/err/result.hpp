@@ -0,0 +1,482 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_RESULT_HPP
+#define ERR_RESULT_HPP
+
+#include "err/detail/contract_level.hpp"
+#include "err/detail/error_impl.hpp"
+#include "err/detail/forward_like.hpp"
+#include "err/detail/result_storage.hpp"
+
+#include <concepts>
+#include <expected>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace err
+{
+template<typename T, class E>
+    requires detail::is_error_impl_v<E>
+class result;
+
+namespace detail
+{
+template<typename T>
+inline constexpr bool is_result_v = false;
+
+template<typename T, class E>
+inline constexpr bool is_result_v<result<T, E>> = true;
+
+template<typename T>
+inline constexpr bool is_unexpected_v = false;
+
+template<typename E>
+inline constexpr bool is_unexpected_v<std::unexpected<E>> = true;
+} // namespace detail
+
+template<typename T, class E>
+    requires detail::is_error_impl_v<E>
+class result
+{
+  public:
+    using value_type      = T;
+    using error_type      = E;
+    using unexpected_type = std::unexpected<E>;
+
+    template<typename U>
+    using rebind = result<U, E>;
+
+    constexpr result() noexcept(std::is_void_v<T> || std::is_nothrow_default_constructible_v<T>)
+        requires(std::is_void_v<T> || std::is_default_constructible_v<T>)
+        : m_storage(std::in_place)
+    {
+    }
+
+    template<typename U = std::remove_cv_t<T>>
+        requires(!std::is_void_v<T> && std::is_constructible_v<T, U> && !std::same_as<std::remove_cvref_t<U>, result>
+                 && !std::same_as<std::remove_cvref_t<U>, std::in_place_t>
+                 && !(detail::is_error_impl_v<std::remove_cvref_t<U>> && std::is_constructible_v<E, U>)
+                 && !detail::is_unexpected_v<std::remove_cvref_t<U>>)
+    constexpr explicit(!std::is_convertible_v<U, T>) result(U&& value) noexcept(std::is_nothrow_constructible_v<T, U>)
+        : m_storage(std::in_place, std::forward<U>(value))
+    {
+    }
+
+    template<class... Args>
+        requires(std::is_void_v<T> ? sizeof...(Args) == 0 : std::is_constructible_v<T, Args...>)
+    constexpr explicit result(std::in_place_t /*tag*/, Args&&... args)
+        : m_storage(std::in_place, std::forward<Args>(args)...)
+    {
+    }
+
+    template<auto... Es>
+        requires std::is_constructible_v<E, detail::error_impl<Es...>>
+    constexpr explicit(!std::is_convertible_v<detail::error_impl<Es...>, E>)
+        result(detail::error_impl<Es...> e) noexcept(std::is_nothrow_constructible_v<E, detail::error_impl<Es...>>)
+        : m_storage(E(e))
+    {
+    }
+
+    template<class G>
+        requires std::is_constructible_v<E, G const&>
+    constexpr explicit(!std::is_convertible_v<G const&, E>) result(std::unexpected<G> const& e)
+        : m_storage(E(e.error()))
+    {
+    }
+
+    template<class... Args>
+        requires std::is_constructible_v<E, Args...>
+    constexpr explicit result(std::unexpect_t /*tag*/, Args&&... args)
+        : m_storage(E(std::forward<Args>(args)...))
+    {
+    }
+
+    template<typename U, class G>
+        requires(!std::same_as<result<U, G>, result> && std::is_void_v<T> == std::is_void_v<U>
+                 && (std::is_void_v<T> || std::is_constructible_v<T, U const&>) && std::is_constructible_v<E, G>)
+    constexpr explicit(!(std::is_void_v<T> || std::is_convertible_v<U const&, T>) || !std::is_convertible_v<G, E>)
+        result(result<U, G> const& other)
+        : m_storage(convert_storage(other))
+    {
+    }
+
+    template<typename U, class G>
+        requires(!std::same_as<result<U, G>, result> && std::is_void_v<T> == std::is_void_v<U>
+                 && (std::is_void_v<T> || std::is_constructible_v<T, U>) && std::is_constructible_v<E, G>)
+    constexpr explicit(!(std::is_void_v<T> || std::is_convertible_v<U, T>) || !std::is_convertible_v<G, E>)
+        result(result<U, G>&& other)
+        : m_storage(convert_storage(std::move(other)))
+    {
+    }
+
+    constexpr result(std::expected<T, E> const& other)
+        : m_storage(convert_storage(other))
+    {
+    }
+
+    constexpr result(std::expected<T, E>&& other)
+        : m_storage(convert_storage(std::move(other)))
+    {
+    }
+
+    constexpr operator std::expected<T, E>() const&
+    {
+        if (!has_value())
+            return std::expected<T, E>{std::unexpect, error()};
+        if constexpr (std::is_void_v<T>)
+            return std::expected<T, E>{};
+        else
+            return std::expected<T, E>{std::in_place, **this};
+    }
+
+    constexpr operator std::expected<T, E>() &&
+    {
+        if (!has_value())
+            return std::expected<T, E>{std::unexpect, error()};
+        if constexpr (std::is_void_v<T>)
+            return std::expected<T, E>{};
+        else
+            return std::expected<T, E>{std::in_place, *std::move(*this)};
+    }
+
+    [[nodiscard]] constexpr auto has_value() const noexcept -> bool { return m_storage.has_value(); }
+    constexpr explicit operator bool() const noexcept { return has_value(); }
+
+    template<typename U = T>
+        requires(!std::is_void_v<U>)
+    constexpr auto operator*() & noexcept -> U&
+    {
+        ERR_DETAIL_PRECONDITION(has_value());
+        return m_storage.value();
+    }
+    template<typename U = T>
+        requires(!std::is_void_v<U>)
+    constexpr auto operator*() const& noexcept -> U const&
+    {
+        ERR_DETAIL_PRECONDITION(has_value());
+        return m_storage.value();
+    }
+    template<typename U = T>
+        requires(!std::is_void_v<U>)
+    constexpr auto operator*() && noexcept -> U&&
+    {
+        ERR_DETAIL_PRECONDITION(has_value());
+        return std::move(m_storage).value();
+    }
+    template<typename U = T>
+        requires(!std::is_void_v<U>)
+    constexpr auto operator*() const&& noexcept -> U const&&
+    {
+        ERR_DETAIL_PRECONDITION(has_value());
+        return std::move(m_storage).value();
+    }
+    constexpr void operator*() const noexcept
+        requires std::is_void_v<T>
+    {
+        ERR_DETAIL_PRECONDITION(has_value());
+    }
+
+    template<typename U = T>
+        requires(!std::is_void_v<U>)
+    constexpr auto operator->() noexcept -> U*
+    {
+        return std::addressof(**this);
+    }
+    template<typename U = T>
+        requires(!std::is_void_v<U>)
+    constexpr auto operator->() const noexcept -> U const*
+    {
+        return std::addressof(**this);
+    }
+
+    constexpr auto value() & -> decltype(auto) { return value_impl(*this); }
+    constexpr auto value() const& -> decltype(auto) { return value_impl(*this); }
+    constexpr auto value() && -> decltype(auto) { return value_impl(std::move(*this)); }
+    constexpr auto value() const&& -> decltype(auto) { return value_impl(std::move(*this)); }
+
+    constexpr auto error() const noexcept -> E
+    {
+        ERR_DETAIL_PRECONDITION(!has_value());
+        return m_storage.error();
+    }
+
+    template<class U>
+        requires(!std::is_void_v<T>)
+    constexpr auto value_or(U&& default_value) const& -> T
+    {
+        return has_value() ? **this : static_cast<T>(std::forward<U>(default_value));
+    }
+    template<class U>
+        requires(!std::is_void_v<T>)
+    constexpr auto value_or(U&& default_value) && -> T
+    {
+        return has_value() ? *std::move(*this) : static_cast<T>(std::forward<U>(default_value));
+    }
+
+    template<class F>
+    constexpr auto and_then(F&& f) &
+    {
+        return and_then_impl(*this, std::forward<F>(f));
+    }
+    template<class F>
+    constexpr auto and_then(F&& f) const&
+    {
+        return and_then_impl(*this, std::forward<F>(f));
+    }
+    template<class F>
+    constexpr auto and_then(F&& f) &&
+    {
+        return and_then_impl(std::move(*this), std::forward<F>(f));
+    }
+    template<class F>
+    constexpr auto and_then(F&& f) const&&
+    {
+        return and_then_impl(std::move(*this), std::forward<F>(f));
+    }
+
+    template<class F>
+    constexpr auto or_else(F&& f) &
+    {
+        return or_else_impl(*this, std::forward<F>(f));
+    }
+    template<class F>
+    constexpr auto or_else(F&& f) const&
+    {
+        return or_else_impl(*this, std::forward<F>(f));
+    }
+    template<class F>
+    constexpr auto or_else(F&& f) &&
+    {
+        return or_else_impl(std::move(*this), std::forward<F>(f));
+    }
+    template<class F>
+    constexpr auto or_else(F&& f) const&&
+    {
+        return or_else_impl(std::move(*this), std::forward<F>(f));
+    }
+
+    template<class F>
+    constexpr auto transform(F&& f) &
+    {
+        return transform_impl(*this, std::forward<F>(f));
+    }
+    template<class F>
+    constexpr auto transform(F&& f) const&
+    {
+        return transform_impl(*this, std::forward<F>(f));
+    }
+    template<class F>
+    constexpr auto transform(F&& f) &&
+    {
+        return transform_impl(std::move(*this), std::forward<F>(f));
+    }
+    template<class F>
+    constexpr auto transform(F&& f) const&&
+    {
+        return transform_impl(std::move(*this), std::forward<F>(f));
+    }
+
+    template<class F>
+    constexpr auto transform_error(F&& f) &
+    {
+        return transform_error_impl(*this, std::forward<F>(f));
+    }
+    template<class F>
+    constexpr auto transform_error(F&& f) const&
+    {
+        return transform_error_impl(*this, std::forward<F>(f));
+    }
+    template<class F>
+    constexpr auto transform_error(F&& f) &&
+    {
+        return transform_error_impl(std::move(*this), std::forward<F>(f));
+    }
+    template<class F>
+    constexpr auto transform_error(F&& f) const&&
+    {
+        return transform_error_impl(std::move(*this), std::forward<F>(f));
+    }
+
+    template<typename U, class G>
+        requires(std::is_void_v<T> == std::is_void_v<U>)
+    friend constexpr auto operator==(result const& lhs, result<U, G> const& rhs) -> bool
+    {
+        if (lhs.has_value() != rhs.has_value())
+            return false;
+        if (!lhs.has_value())
+            return lhs.error() == rhs.error();
+        if constexpr (std::is_void_v<T>)
+            return true;
+        else
+            return *lhs == *rhs;
+    }
+
+    template<class U>
+        requires(!std::is_void_v<T> && !detail::is_result_v<U> && !detail::is_error_impl_v<U>
+                 && !detail::is_unexpected_v<U>)
+    friend constexpr auto operator==(result const& lhs, U const& value) -> bool
+    {
+        return lhs.has_value() && *lhs == value;
+    }
+
+    template<auto... Es>
+        requires std::equality_comparable_with<E, detail::error_impl<Es...>>
+    friend constexpr auto operator==(result const& lhs, detail::error_impl<Es...> e) noexcept -> bool
+    {
+        return !lhs.has_value() && lhs.error() == e;
+    }
+
+    template<class G>
+    friend constexpr auto operator==(result const& lhs, std::unexpected<G> const& e) -> bool
+    {
+        return !lhs.has_value() && lhs.error() == e.error();
+    }
+
+  private:
+    template<class Other>
+    static constexpr auto convert_storage(Other&& other) -> detail::result_storage<T, E>
+    {
+        if (!other.has_value())
+            return detail::result_storage<T, E>(E(other.error()));
+        if constexpr (std::is_void_v<T>)
+            return detail::result_storage<T, E>(std::in_place);
+        else
+            return detail::result_storage<T, E>(std::in_place, *std::forward<Other>(other));
+    }
+
+    template<class Self>
+    static constexpr auto value_impl(Self&& self) -> decltype(auto)
+    {
+        if (!self.has_value())
+            throw std::bad_expected_access<E>(self.error());
+        if constexpr (!std::is_void_v<T>)
+            return *std::forward<Self>(self);
+    }
+
+    template<class Self, class F>
+    static constexpr auto and_then_impl(Self&& self, F&& f)
+    {
+        if constexpr (std::is_void_v<T>)
+        {
+            using U = std::remove_cvref_t<std::invoke_result_t<F>>;
+            if (self.has_value())
+                return std::invoke(std::forward<F>(f));
+            return U(std::unexpect, self.error());
+        }
+        else
+        {
+            using U = std::remove_cvref_t<std::invoke_result_t<F, decltype(*std::forward<Self>(self))>>;
+            if (self.has_value())
+                return std::invoke(std::forward<F>(f), *std::forward<Self>(self));
+            return U(std::unexpect, self.error());
+        }
+    }
+
+    template<class Self, class F>
+    static constexpr auto or_else_impl(Self&& self, F&& f)
+    {
+        using G = std::remove_cvref_t<std::invoke_result_t<F, E>>;
+        if (!self.has_value())
+            return std::invoke(std::forward<F>(f), self.error());
+        if constexpr (std::is_void_v<T>)
+            return G();
+        else
+            return G(std::in_place, *std::forward<Self>(self));
+    }
+
+    template<class Self, class F>
+    static constexpr auto transform_impl(Self&& self, F&& f)
+    {
+        if constexpr (std::is_void_v<T>)
+        {
+            using U = std::remove_cv_t<std::invoke_result_t<F>>;
+            if (!self.has_value())
+                return result<U, E>(std::unexpect, self.error());
+            if constexpr (std::is_void_v<U>)
+            {
+                std::invoke(std::forward<F>(f));
+                return result<U, E>();
+            }
+            else
+                return result<U, E>(std::in_place, std::invoke(std::forward<F>(f)));
+        }
+        else
+        {
+            using U = std::remove_cv_t<std::invoke_result_t<F, decltype(*std::forward<Self>(self))>>;
+            if (!self.has_value())
+                return result<U, E>(std::unexpect, self.error());
+            if constexpr (std::is_void_v<U>)
+            {
+                std::invoke(std::forward<F>(f), *std::forward<Self>(self));
+                return result<U, E>();
+            }
+            else
+                return result<U, E>(std::in_place, std::invoke(std::forward<F>(f), *std::forward<Self>(self)));
+        }
+    }
+
+    template<class Self, class F>
+    static constexpr auto transform_error_impl(Self&& self, F&& f)
+    {
+        using G = std::remove_cv_t<std::invoke_result_t<F, E>>;
+        if (!self.has_value())
+            return result<T, G>(std::unexpect, std::invoke(std::forward<F>(f), self.error()));
+        if constexpr (std::is_void_v<T>)
+            return result<T, G>();
+        else
+            return result<T, G>(std::in_place, *std::forward<Self>(self));
+    }
+
+    detail::result_storage<T, E> m_storage;
+};
+
+template<class Visitor, typename T, auto... Es>
+constexpr auto transform_error(Visitor&& vis, result<T, detail::error_impl<Es...>>& r) -> decltype(auto)
+{
+    return detail::transform_expected_error(std::forward<Visitor>(vis), r);
+}
+
+template<class Visitor, typename T, auto... Es>
+constexpr auto transform_error(Visitor&& vis, result<T, detail::error_impl<Es...>> const& r) -> decltype(auto)
+{
+    return detail::transform_expected_error(std::forward<Visitor>(vis), r);
+}
+
+template<class Visitor, typename T, auto... Es>
+constexpr auto transform_error(Visitor&& vis, result<T, detail::error_impl<Es...>>&& r) -> decltype(auto)
+{
+    return detail::transform_expected_error(std::forward<Visitor>(vis), std::move(r));
+}
+
+template<class Visitor, typename T, auto... Es>
+constexpr auto transform_error(Visitor&& vis, result<T, detail::error_impl<Es...>> const&& r) -> decltype(auto)
+{
+    return detail::transform_expected_error(std::forward<Visitor>(vis), std::move(r));
+}
+} // namespace err
+
+#endif // ERR_RESULT_HPP
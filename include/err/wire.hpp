@@ -0,0 +1,197 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ERR_WIRE_HPP
+#define ERR_WIRE_HPP
+
+#include "err/detail/contract_level.hpp"
+#include "err/detail/error_impl.hpp"
+#include "err/detail/index_of.hpp"
+#include "err/detail/smallest_unsigned.hpp"
+#include "err/detail/sorted_values.hpp"
+#include "err/error.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <expected>
+#include <limits>
+#include <ranges>
+#include <span>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace err
+{
+// Reasons for rejecting encoded errors
+enum class wire_errc
+{
+    schema_mismatch, // the peer encoded a different set of enumerators
+    truncated,       // the input is shorter than its header, or than its header says
+    count_mismatch,  // the input holds more errors than the output has room for
+    invalid_value,   // a code doesn't correspond to any possible value
+};
+using wire_error =
+    error<wire_errc::schema_mismatch, wire_errc::truncated, wire_errc::count_mismatch, wire_errc::invalid_value>;
+
+// Number of bits an error of type Error occupies in a batch
+template<class Error>
+    requires detail::is_error_impl_v<Error>
+inline constexpr std::size_t wire_bits_v = static_cast<std::size_t>(std::bit_width(Error::possible_values.size() - 1));
+
+// Identifies the set of enumerators of Error, independent of their order; peers must agree on it to exchange errors
+template<class Error>
+    requires detail::is_error_impl_v<Error>
+inline constexpr std::uint64_t wire_fingerprint_v = []()
+{
+    // FNV-1a over the number of values and the bytes of all values in ascending order
+    std::uint64_t hash     = 0xcbf2'9ce4'8422'2325;
+    auto const    add_word = [&hash](std::uint64_t word)
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            hash ^= (word >> (8 * i)) & 0xFF;
+            hash *= 0x100'0000'01b3;
+        }
+    };
+    add_word(Error::possible_values.size());
+    for (auto const value : detail::sorted_values<Error::possible_values>)
+        add_word(detail::to_unsigned(value));
+    return hash;
+}();
+
+// Code of a single error: the position of its value in possible_values
+template<class Error>
+    requires detail::is_error_impl_v<Error>
+using wire_code_t = detail::smallest_unsigned_t<Error::possible_values.size() - 1>;
+
+template<auto... Es>
+constexpr auto encode(detail::error_impl<Es...> e) noexcept -> wire_code_t<detail::error_impl<Es...>>
+{
+    return static_cast<wire_code_t<detail::error_impl<Es...>>>(detail::error_access::index(e));
+}
+
+template<class Error>
+    requires detail::is_error_impl_v<Error>
+constexpr auto decode(wire_code_t<Error> code) noexcept -> std::expected<Error, wire_error>
+{
+    if (code >= Error::possible_values.size())
+        return std::unexpected{wire_error{wire_errc::invalid_value}};
+    return detail::error_access::from_index<Error>(code);
+}
+
+// Number of words needed to encode count errors: the fingerprint and count, followed by the codes packed into
+// wire_bits_v bits each, least significant bits first
+template<class Error>
+    requires detail::is_error_impl_v<Error>
+constexpr auto encoded_size(std::size_t count) noexcept -> std::size_t
+{
+    return 2 + (count * wire_bits_v<Error> + 63) / 64;
+}
+
+// Encodes errors into the beginning of out, and returns the number of words written
+template<std::ranges::random_access_range Errors>
+    requires std::ranges::sized_range<Errors> && detail::is_error_impl_v<std::ranges::range_value_t<Errors>>
+constexpr auto encode(Errors const& errors, std::span<std::uint64_t> out) -> std::size_t
+{
+    using error_type    = std::ranges::range_value_t<Errors>;
+    constexpr auto bits = wire_bits_v<error_type>;
+
+    auto const count = std::ranges::size(errors);
+    auto const size  = encoded_size<error_type>(count);
+    ERR_DETAIL_PRECONDITION(out.size() >= size);
+
+    out[0] = wire_fingerprint_v<error_type>;
+    out[1] = count;
+    std::ranges::fill(out.subspan(2, size - 2), 0);
+    if constexpr (bits > 0)
+    {
+        auto const words = out.subspan(2);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            auto const code   = static_cast<std::uint64_t>(detail::error_access::index(std::ranges::begin(errors)[i]));
+            auto const bit    = i * bits;
+            auto const offset = bit % 64;
+            words[bit / 64] |= code << offset;
+            if constexpr (64 % bits != 0)
+            {
+                if (offset + bits > 64)
+                    words[bit / 64 + 1] |= code >> (64 - offset);
+            }
+        }
+    }
+    return size;
+}
+
+// Decodes the errors encoded in in into the beginning of out, and returns their number; in must have been encoded for
+// the same set of enumerators
+template<std::ranges::random_access_range Errors>
+    requires std::ranges::sized_range<Errors> && detail::is_error_impl_v<std::ranges::range_value_t<Errors>>
+constexpr auto decode(std::span<std::uint64_t const> in, Errors&& out) -> std::expected<std::size_t, wire_error>
+{
+    using error_type    = std::ranges::range_value_t<Errors>;
+    constexpr auto bits = wire_bits_v<error_type>;
+    constexpr auto mask = bits == 64 ? std::numeric_limits<std::uint64_t>::max() : (std::uint64_t{1} << bits) - 1;
+
+    if (in.size() < 2)
+        return std::unexpected{wire_error{wire_errc::truncated}};
+    if (in[0] != wire_fingerprint_v<error_type>)
+        return std::unexpected{wire_error{wire_errc::schema_mismatch}};
+    // Checked before the size, so a corrupt count can't overflow encoded_size
+    auto const count = in[1];
+    if (count > std::ranges::size(out))
+        return std::unexpected{wire_error{wire_errc::count_mismatch}};
+    if (in.size() < encoded_size<error_type>(count))
+        return std::unexpected{wire_error{wire_errc::truncated}};
+
+    // Codes are checked all at once after decoding; if every code of the given width is valid, there is nothing to do
+    constexpr bool all_codes_valid = mask < error_type::possible_values.size();
+    bool           valid           = true;
+    auto const     words           = in.subspan(2);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        std::uint64_t code = 0;
+        if constexpr (bits > 0)
+        {
+            auto const bit    = i * bits;
+            auto const offset = bit % 64;
+            code              = words[bit / 64] >> offset;
+            if constexpr (64 % bits != 0)
+            {
+                if (offset + bits > 64)
+                    code |= words[bit / 64 + 1] << (64 - offset);
+            }
+            code &= mask;
+        }
+        if constexpr (!all_codes_valid)
+            valid &= code < error_type::possible_values.size();
+        std::ranges::begin(out)[i] = detail::error_access::from_index<error_type>(valid ? code : 0);
+    }
+    if (!valid)
+        return std::unexpected{wire_error{wire_errc::invalid_value}};
+    return count;
+}
+} // namespace err
+
+#endif // ERR_WIRE_HPP
@@ -0,0 +1,79 @@
+#
+# MIT License
+#
+# Copyright (c) 2023 Jan Möller
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+
+# Compares the dispatch of two functions in an x86-64 ELF assembly listing: each must contain exactly one indirect jump,
+# and be preceded by the same number of instructions.
+#
+# Usage: cmake -D ASSEMBLY=<file> -D REFERENCE=<function> -D CANDIDATE=<function> -P compare_dispatch.cmake
+
+foreach (variable ASSEMBLY REFERENCE CANDIDATE)
+    if (NOT DEFINED ${variable})
+        message(FATAL_ERROR "${variable} must be defined")
+    endif ()
+endforeach ()
+
+file(STRINGS ${ASSEMBLY} lines)
+
+# Sets <out>_dispatch to the instructions before the indirect jump, and <out>_jumps to the number of indirect jumps
+function(read_function name out)
+    set(inside FALSE)
+    set(dispatch)
+    set(jumps 0)
+    foreach (line IN LISTS lines)
+        if (line STREQUAL "${name}:")
+            set(inside TRUE)
+        elseif (inside AND line MATCHES "^[ \t]*\\.size[ \t]+${name},")
+            break()
+        elseif (inside AND line MATCHES "^[ \t]+([a-z][a-z0-9]*)[ \t]*(.*)$")
+            set(mnemonic ${CMAKE_MATCH_1})
+            set(operands "${CMAKE_MATCH_2}")
+            if (mnemonic MATCHES "^jmpq?$" AND operands MATCHES "^\\*")
+                math(EXPR jumps "${jumps} + 1")
+            elseif (jumps EQUAL 0)
+                list(APPEND dispatch ${mnemonic})
+            endif ()
+        endif ()
+    endforeach ()
+    if (NOT inside)
+        message(FATAL_ERROR "${name} not found in ${ASSEMBLY}")
+    endif ()
+    set(${out}_dispatch ${dispatch} PARENT_SCOPE)
+    set(${out}_jumps ${jumps} PARENT_SCOPE)
+endfunction()
+
+read_function(${REFERENCE} reference)
+read_function(${CANDIDATE} candidate)
+
+list(LENGTH reference_dispatch reference_length)
+list(LENGTH candidate_dispatch candidate_length)
+message(STATUS "${REFERENCE}: ${reference_jumps} indirect jump(s), after ${reference_dispatch}")
+message(STATUS "${CANDIDATE}: ${candidate_jumps} indirect jump(s), after ${candidate_dispatch}")
+
+if (NOT reference_jumps EQUAL 1 OR NOT candidate_jumps EQUAL 1)
+    message(FATAL_ERROR "expected both functions to dispatch with a single indirect jump")
+endif ()
+if (NOT candidate_length EQUAL reference_length)
+    message(FATAL_ERROR "${CANDIDATE} needs ${candidate_length} instructions to dispatch, "
+            "${REFERENCE} needs ${reference_length}")
+endif ()
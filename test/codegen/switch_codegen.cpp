@@ -0,0 +1,91 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+// Two switches over the same enumeration, once on a raw enumerator and once on an error through err::match. The
+// err-switch-codegen test checks that both dispatch with a single indirect jump, preceded by as many instructions.
+
+#include "err/error.hpp"
+
+#include <utility>
+
+enum class io_error
+{
+    not_found = 1,
+    permission_denied,
+    connection_refused,
+    connection_reset,
+    timed_out,
+    would_block,
+    interrupted,
+};
+using enum io_error;
+
+using io_error_type = err::error<not_found,
+                                 permission_denied,
+                                 connection_refused,
+                                 connection_reset,
+                                 timed_out,
+                                 would_block,
+                                 interrupted>;
+
+extern "C"
+{
+auto on_not_found() -> int;
+auto on_permission_denied() -> int;
+auto on_connection_refused() -> int;
+auto on_connection_reset() -> int;
+auto on_timed_out() -> int;
+auto on_would_block() -> int;
+auto on_interrupted() -> int;
+
+auto handle_raw(io_error e) -> int
+{
+    switch (e)
+    {
+    case not_found: return on_not_found();
+    case permission_denied: return on_permission_denied();
+    case connection_refused: return on_connection_refused();
+    case connection_reset: return on_connection_reset();
+    case timed_out: return on_timed_out();
+    case would_block: return on_would_block();
+    case interrupted: return on_interrupted();
+    }
+    std::unreachable();
+}
+
+auto handle_match(io_error_type e) -> int
+{
+    switch (err::match(e))
+    {
+    case not_found: return on_not_found();
+    case permission_denied: return on_permission_denied();
+    case connection_refused: return on_connection_refused();
+    case connection_reset: return on_connection_reset();
+    case timed_out: return on_timed_out();
+    case would_block: return on_would_block();
+    case interrupted: return on_interrupted();
+    }
+    std::unreachable();
+}
+}
@@ -0,0 +1,148 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "err/algorithm.hpp"
+#include "err/error.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <expected>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace err;
+
+namespace
+{
+enum some_error
+{
+    parse_failed,
+    out_of_range,
+    overflow,
+};
+
+using parse_error  = error<parse_failed, out_of_range>;
+using reduce_error = error<overflow>;
+
+auto parse(int i) -> std::expected<int, parse_error>
+{
+    if (i < 0)
+        return std::unexpected{parse_error{parse_failed}};
+    if (i > 1000)
+        return std::unexpected{parse_error{out_of_range}};
+    return i;
+}
+
+auto checked_add(int a, int b) -> std::expected<int, reduce_error>
+{
+    if (a > 100'000 - b)
+        return std::unexpected{reduce_error{}};
+    return a + b;
+}
+
+auto iota(int count) -> std::vector<int>
+{
+    std::vector<int> v(static_cast<std::size_t>(count));
+    std::iota(v.begin(), v.end(), 0);
+    return v;
+}
+
+constexpr parallel_t small_chunks{.thread_count = 4, .min_chunk_size = 8};
+} // namespace
+
+TEST_CASE("collect", "[algorithm]")
+{
+    std::vector<std::expected<int, parse_error>> const all_valid{1, 2, 3};
+    CHECK(collect(all_valid) == std::vector{1, 2, 3});
+
+    std::vector<std::expected<int, parse_error>> const one_invalid{1, std::unexpected{parse_error{out_of_range}}, 3};
+    CHECK(collect(one_invalid) == std::unexpected{parse_error{out_of_range}});
+
+    CHECK(collect(std::vector{4, 5}, parse) == std::vector{4, 5});
+    CHECK(collect(std::vector{4, -5, 2000}, parse) == std::unexpected{parse_error{parse_failed}});
+    CHECK(collect(std::vector<int>{}, parse) == std::vector<int>{});
+
+    auto const values = iota(1000);
+    CHECK(collect(small_chunks, values, parse) == values);
+    CHECK(collect(parallel, values, parse) == values);
+    CHECK(collect(small_chunks, std::vector{7}, parse) == std::vector{7});
+
+    auto invalid = values;
+    invalid[517] = -1;
+    CHECK(collect(small_chunks, invalid, parse) == std::unexpected{parse_error{parse_failed}});
+}
+
+TEST_CASE("transform_reduce", "[algorithm]")
+{
+    using result_error = std::remove_cvref_t<decltype(transform_reduce(std::vector<int>{}, 0, checked_add, parse))>;
+    CHECK(std::is_same_v<result_error, std::expected<int, error<parse_failed, out_of_range, overflow>>>);
+    CHECK(std::is_same_v<decltype(transform_reduce(std::vector<int>{}, 0, std::plus{}, parse)),
+                         std::expected<int, parse_error>>);
+
+    auto const values = iota(400);
+    CHECK(transform_reduce(values, 0, std::plus{}, parse) == 79'800);
+    CHECK(transform_reduce(values, 0, checked_add, parse) == 79'800);
+    CHECK(transform_reduce(values, 30'000, checked_add, parse) == std::unexpected{overflow});
+    CHECK(transform_reduce(std::vector{1, -1}, 0, checked_add, parse) == std::unexpected{parse_failed});
+
+    CHECK(transform_reduce(small_chunks, values, 5, checked_add, parse) == 79'805);
+    CHECK(transform_reduce(parallel, values, 5, checked_add, parse) == 79'805);
+    CHECK(transform_reduce(small_chunks, values, 30'000, checked_add, parse) == std::unexpected{overflow});
+    CHECK(transform_reduce(small_chunks, std::vector<int>{}, 5, checked_add, parse) == 5);
+
+    auto invalid = iota(400);
+    invalid[399] = 1001;
+    CHECK(transform_reduce(small_chunks, invalid, 0, checked_add, parse) == std::unexpected{out_of_range});
+
+    // Chunks are reduced in order, so associativity is sufficient
+    std::vector<std::string> const words{"a", "b", "c", "d", "e", "f", "g", "h",
+                                         "i", "j", "k", "l", "m", "n", "o", "p"};
+    auto const to_string = [](std::string const& s) -> std::expected<std::string, parse_error> { return s; };
+    CHECK(transform_reduce(parallel_t{.thread_count = 4, .min_chunk_size = 2}, words, std::string{">"}, std::plus{},
+                           to_string)
+          == ">abcdefghijklmnop");
+}
+
+TEST_CASE("parallel algorithms propagate exceptions", "[algorithm]")
+{
+    auto const throwing = [](int i) -> std::expected<int, parse_error>
+    {
+        if (i == 300)
+            throw std::runtime_error{"boom"};
+        return i;
+    };
+    bool thrown = false;
+    try
+    {
+        (void)collect(small_chunks, iota(400), throwing);
+    }
+    catch (std::runtime_error const&)
+    {
+        thrown = true;
+    }
+    CHECK(thrown);
+}
@@ -0,0 +1,116 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "err/any_error.hpp"
+#include "err/error.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <concepts>
+#include <optional>
+#include <type_traits>
+#include <unordered_set>
+
+#include <cstdint>
+
+using namespace err;
+
+namespace
+{
+enum some_error
+{
+    foo,
+    bar,
+    baz,
+};
+
+enum class other_error : std::int8_t
+{
+    first = -3,
+    second,
+};
+
+enum class wide_error : std::uint64_t
+{
+    small = 1,
+    large = 0x1'0000'0000,
+};
+
+enum class clashing_error
+{
+    foo,
+};
+} // namespace
+
+template<>
+inline constexpr std::uint32_t err::enum_id_v<clashing_error> = err::enum_id_v<some_error>;
+
+TEST_CASE("any_error", "[any_error]")
+{
+    CHECK(sizeof(any_error) == sizeof(std::uint64_t));
+    CHECK(std::is_trivially_copyable_v<any_error>);
+    CHECK(enum_id_v<some_error> != enum_id_v<other_error>);
+    CHECK(std::is_nothrow_convertible_v<error<foo, bar>, any_error>);
+    CHECK(std::is_convertible_v<error<wide_error::small>, any_error>);
+    CHECK(!std::is_convertible_v<error<wide_error::small, wide_error::large>, any_error>);
+
+    any_error const e = error<foo, bar>{bar};
+    CHECK(e.holds<some_error>());
+    CHECK(!e.holds<other_error>());
+    CHECK(e.type_id() == enum_id_v<some_error>);
+    CHECK(e == bar);
+    CHECK(e != foo);
+    CHECK(e != other_error::second);
+    CHECK(e == error<bar, baz>{bar});
+    CHECK(e != error<foo>{});
+
+    CHECK(e.as<error<bar>>() == error<bar>{});
+    CHECK(e.as<error<foo, bar, baz>>() == bar);
+    CHECK(e.as<error<foo, baz>>() == std::nullopt);
+    CHECK(e.as<error<other_error::first, other_error::second>>() == std::nullopt);
+
+    any_error const negative = error<other_error::first, other_error::second>{other_error::first};
+    CHECK(negative == other_error::first);
+    CHECK(negative.as<error<other_error::first>>() == other_error::first);
+    CHECK(negative != e);
+
+    CHECK(any_error::from_bits(e.bits()) == e);
+}
+EVAL_TEST_CASE("any_error");
+
+TEST_CASE("any_error id clash", "[any_error]")
+{
+    CHECK(detail::enum_id_unique<some_error>());
+    CHECK(detail::enum_id_unique<other_error>());
+    CHECK(!detail::enum_id_unique<clashing_error>());
+    CHECK(detail::enum_id_unique<other_error>());
+}
+
+TEST_CASE("any_error hash", "[any_error]")
+{
+    std::unordered_set<any_error> const set{error<foo>{}, error<other_error::first>{}, error<foo, bar>{foo}};
+    CHECK(set.size() == 2);
+    CHECK(set.contains(error<other_error::first>{}));
+    CHECK(!set.contains(error<bar>{}));
+}
@@ -70,6 +70,8 @@ TEST_CASE("assignability from related error", "[error]")
     CHECK(std::is_assignable_v<error<foo, bar, baz>, error<foo>>);
     CHECK(std::is_assignable_v<error<foo, bar, baz>, error<bar>>);
     CHECK(std::is_assignable_v<error<foo, bar, baz>, error<baz>>);
+    CHECK(std::is_assignable_v<error<foo, bar, baz>, error<foo, bar>>);
+    CHECK(std::is_assignable_v<error<foo, bar, baz>, error<foo, baz>>);
     CHECK(std::is_assignable_v<error<foo, bar, baz>, error<bar, baz>>);
     CHECK(std::is_assignable_v<error<foo, bar, baz>, error<foo, bar, baz>>);
 
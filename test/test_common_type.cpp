@@ -25,6 +25,7 @@
 
 #include <bugspray/bugspray.hpp>
 
+#include <array>
 #include <concepts>
 
 using namespace err;
@@ -42,5 +43,28 @@ TEST_CASE("common_type", "[error]")
     CHECK(std::same_as<std::common_type_t<error<foo, bar>, error<bar>>, error<foo, bar>>);
     CHECK(std::same_as<std::common_type_t<error<foo, bar>, error<baz>>, error<foo, bar, baz>>);
     CHECK(std::same_as<std::common_type_t<error<foo>, error<bar>, error<baz>>, error<foo, bar, baz>>);
+    CHECK(std::same_as<std::common_type_t<error<baz>, error<foo, baz>, error<bar>, error<foo>>, error<foo, bar, baz>>);
+    CHECK(std::same_as<std::common_type_t<error<bar>, error<bar>, error<bar>>, error<bar>>);
 }
-EVAL_TEST_CASE("common_type");
\ No newline at end of file
+EVAL_TEST_CASE("common_type");
+
+TEST_CASE("common_error_t", "[error]")
+{
+    CHECK(std::same_as<common_error_t<error<bar, foo>>, error<foo, bar>>);
+    CHECK(std::same_as<common_error_t<error<foo>, error<bar>>, std::common_type_t<error<foo>, error<bar>>>);
+    CHECK(std::same_as<common_error_t<error<foo>, error<bar>, error<baz>>, error<foo, bar, baz>>);
+    CHECK(std::same_as<common_error_t<error<baz>, error<foo, baz>, error<bar>, error<foo>>, error<foo, bar, baz>>);
+    CHECK(std::same_as<common_error_t<error<bar>, error<bar>, error<bar>>, error<bar>>);
+}
+EVAL_TEST_CASE("common_error_t");
+
+TEST_CASE("canonical error", "[error]")
+{
+    CHECK(std::same_as<error<baz, foo, bar>, error<foo, bar, baz>>);
+    CHECK(std::same_as<error<bar, foo, bar, foo>, error<foo, bar>>);
+    CHECK(error<baz, foo, bar>::possible_values == std::array{foo, bar, baz});
+    CHECK(std::same_as<detail::canonical_error<std::array{baz, foo}, std::array{bar}, std::array{foo}>::type,
+                       error<foo, bar, baz>>);
+    CHECK(detail::canonical_values<std::array{bar, foo}, std::array{baz, bar}> == std::array{foo, bar, baz});
+}
+EVAL_TEST_CASE("canonical error");
@@ -25,6 +25,7 @@
 
 #include <bugspray/bugspray.hpp>
 
+#include <expected>
 #include <type_traits>
 
 using namespace err;
@@ -85,6 +86,10 @@ TEST_CASE("constructibility from related error", "[error]")
           && std::is_convertible_v<error<bar>, error<foo, bar, baz>>);
     CHECK(std::is_nothrow_constructible_v<error<foo, bar, baz>, error<baz>>
           && std::is_convertible_v<error<baz>, error<foo, bar, baz>>);
+    CHECK(std::is_nothrow_constructible_v<error<foo, bar, baz>, error<foo, bar>>
+          && std::is_convertible_v<error<foo, bar>, error<foo, bar, baz>>);
+    CHECK(std::is_nothrow_constructible_v<error<foo, bar, baz>, error<foo, baz>>
+          && std::is_convertible_v<error<foo, baz>, error<foo, bar, baz>>);
     CHECK(std::is_nothrow_constructible_v<error<foo, bar, baz>, error<bar, baz>>
           && std::is_convertible_v<error<bar, baz>, error<foo, bar, baz>>);
     CHECK(std::is_nothrow_constructible_v<error<foo, bar, baz>, error<foo, bar, baz>>
@@ -120,10 +125,38 @@ TEST_CASE("constructibility from related error", "[error]")
     CHECK(error<foo, bar, baz>{error<baz>{}} == baz);
     CHECK(error<foo, bar, baz>{error<foo, bar>{foo}} == foo);
     CHECK(error<foo, bar, baz>{error<foo, bar>{bar}} == bar);
+    CHECK(error<foo, bar, baz>{error<foo, baz>{foo}} == foo);
+    CHECK(error<foo, bar, baz>{error<foo, baz>{baz}} == baz);
     CHECK(error<foo, bar, baz>{error<bar, baz>{bar}} == bar);
     CHECK(error<foo, bar, baz>{error<bar, baz>{baz}} == baz);
     CHECK(error<foo, bar, baz>{error<foo, bar, baz>{foo}} == foo);
     CHECK(error<foo, bar, baz>{error<foo, bar, baz>{bar}} == bar);
     CHECK(error<foo, bar, baz>{error<foo, bar, baz>{baz}} == baz);
 }
-EVAL_TEST_CASE("constructibility from related error");
\ No newline at end of file
+EVAL_TEST_CASE("constructibility from related error");
+
+namespace
+{
+enum class first_enum
+{
+    x,
+};
+
+enum class second_enum
+{
+    p,
+    q,
+};
+} // namespace
+
+TEST_CASE("constructibility from unrelated error", "[error]")
+{
+    using first  = error<first_enum::x>;
+    using second = error<second_enum::p, second_enum::q>;
+    CHECK(!std::is_constructible_v<first, second> && !std::is_convertible_v<second, first>);
+    CHECK(!std::is_constructible_v<second, first> && !std::is_convertible_v<first, second>);
+    CHECK(!std::is_convertible_v<first, std::expected<int, second>>);
+    CHECK(!std::is_constructible_v<std::expected<int, second>, first>);
+    CHECK(std::is_convertible_v<first, std::expected<int, first>>);
+}
+EVAL_TEST_CASE("constructibility from unrelated error");
@@ -0,0 +1,151 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "err/context.hpp"
+#include "err/error.hpp"
+#include "err/error_with.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <expected>
+#include <iterator>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace err;
+
+namespace
+{
+enum some_error
+{
+    foo,
+    bar,
+    baz,
+};
+
+auto messages(context_chain const& chain) -> std::vector<std::string_view>
+{
+    std::vector<std::string_view> result;
+    for (auto const& frame : chain)
+        result.push_back(frame.message);
+    return result;
+}
+
+auto read_block() -> std::expected<int, error_with_context<error<foo>>>
+{
+    return std::unexpected{add_context(error<foo>{}, "read block")};
+}
+
+auto read_file() -> std::expected<int, error_with_context<error<foo, bar>>>
+{
+    return read_block().transform_error([](auto e) -> error_with_context<error<foo, bar>>
+                                        { return add_context(e, "read file"); });
+}
+} // namespace
+
+TEST_CASE("context chains", "[context]")
+{
+    context_scope const scope;
+
+    CHECK(sizeof(context_handle) == sizeof(std::uint32_t));
+    CHECK(std::forward_iterator<context_chain::iterator>);
+    CHECK(context_chain{context_handle::none}.empty());
+
+    auto const e = add_context(add_context(error<bar>{}, "inner"), "outer");
+    CHECK(e == bar);
+    CHECK(messages(context_chain{e}) == std::vector<std::string_view>{"outer", "inner"});
+    CHECK(context_chain{e}.begin()->location.line() != 0);
+
+    // Chains share the frames they were extended from
+    auto const sibling = add_context(add_context(e, "x"), "y");
+    CHECK(messages(context_chain{sibling}) == std::vector<std::string_view>{"y", "x", "outer", "inner"});
+    CHECK(messages(context_chain{e}) == std::vector<std::string_view>{"outer", "inner"});
+}
+
+TEST_CASE("context chains survive widening", "[context]")
+{
+    context_scope const scope;
+
+    auto const r = read_file();
+    REQUIRE(!r.has_value());
+    CHECK(r.error() == foo);
+    CHECK(messages(context_chain{r.error()}) == std::vector<std::string_view>{"read file", "read block"});
+
+    auto const widened = err::transform_error([](auto e) { return error<foo, bar, baz>{e}; }, r);
+    CHECK(std::same_as<decltype(widened), std::expected<int, error_with_context<error<foo, bar, baz>>> const>);
+    CHECK(widened.error() == foo);
+    CHECK(messages(context_chain{widened.error()}) == std::vector<std::string_view>{"read file", "read block"});
+
+    error_with_context<error<foo, bar, baz>> const converted = r.error();
+    CHECK(messages(context_chain{converted}) == std::vector<std::string_view>{"read file", "read block"});
+}
+
+TEST_CASE("context arena reset", "[context]")
+{
+    auto const e = add_context(error<baz>{}, "before reset");
+    CHECK(!context_chain{e}.empty());
+
+    reset_context();
+    CHECK(context_chain{e}.empty());
+
+    auto const f = add_context(error<baz>{}, "after reset");
+    CHECK(e.payload() != f.payload());
+    CHECK(messages(context_chain{f}) == std::vector<std::string_view>{"after reset"});
+    reset_context();
+}
+
+TEST_CASE("stale context handles", "[context]")
+{
+    auto const e = add_context(error<baz>{}, "stale");
+
+    // Handles are only meaningful on the thread that created them
+    bool empty_on_other_thread = false;
+    std::jthread{[&]
+                 {
+                     add_context(error<baz>{}, "other thread");
+                     empty_on_other_thread = context_chain{e}.empty();
+                 }}
+        .join();
+    CHECK(empty_on_other_thread);
+
+    // Frames at the same position in a later arena state aren't mistaken for the old chain, until the epoch wraps
+    // around. The thread above drew one epoch as well.
+    constexpr std::size_t epoch_count = std::size_t{1} << detail::context_arena::epoch_bits;
+    std::size_t           resets      = 1;
+    for (; resets < epoch_count; ++resets)
+    {
+        reset_context();
+        add_context(error<baz>{}, "unrelated");
+        if (!context_chain{e}.empty())
+            break;
+    }
+    CHECK(resets == epoch_count - 1);
+    CHECK(messages(context_chain{e}) == std::vector<std::string_view>{"unrelated"});
+    reset_context();
+}
@@ -0,0 +1,73 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "err/error.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <optional>
+#include <type_traits>
+
+using namespace err;
+
+namespace
+{
+enum some_error
+{
+    foo,
+    bar,
+    baz,
+};
+
+template<class Error, typename T>
+concept checked_from_valid = requires(T t) { checked_from<Error>(t); };
+} // namespace
+
+TEST_CASE("unchecked construction", "[contract_level]")
+{
+    CHECK(std::is_nothrow_constructible_v<error<foo, bar>, unchecked_t, some_error>);
+    CHECK(std::is_nothrow_constructible_v<error<foo, bar>, unchecked_t, error<foo, bar, baz>>);
+    CHECK(!std::is_constructible_v<error<foo, bar>, unchecked_t, error<baz>>);
+
+    CHECK(error<foo, bar>{unchecked, bar} == bar);
+    CHECK(error<foo, baz>{unchecked, baz} == baz);
+    CHECK(error<bar, baz>{unchecked, error<foo, bar, baz>{bar}} == bar);
+}
+EVAL_TEST_CASE("unchecked construction");
+
+TEST_CASE("checked_from", "[contract_level]")
+{
+    CHECK(checked_from<error<foo, bar>>(bar) == bar);
+    CHECK(checked_from<error<foo, bar>>(baz) == std::nullopt);
+    CHECK(checked_from<error<foo, bar>>(static_cast<some_error>(42)) == std::nullopt);
+    CHECK(checked_from<error<bar, baz>>(error<foo, bar>{bar}) == bar);
+    CHECK(checked_from<error<bar, baz>>(error<foo, bar>{foo}) == std::nullopt);
+    CHECK(checked_from<error<bar>>(error<bar>{}) == bar);
+
+    CHECK(checked_from_valid<error<foo, bar>, some_error>);
+    CHECK(checked_from_valid<error<foo, bar>, error<bar, baz>>);
+    CHECK(!checked_from_valid<error<foo, bar>, error<baz>>);
+    CHECK(!checked_from_valid<error<foo, bar>, int>);
+}
+EVAL_TEST_CASE("checked_from");
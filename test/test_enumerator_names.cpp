@@ -0,0 +1,68 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "err/error.hpp"
+#include "err/format.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <format>
+#include <string>
+
+using namespace err;
+
+namespace
+{
+enum class named_error
+{
+    foo,
+    some_bar,
+    baz = 42,
+};
+} // namespace
+
+TEST_CASE("enumerator names", "[error]")
+{
+    using enum named_error;
+
+    CHECK(error<foo>{}.name() == "foo");
+    CHECK(error<foo, some_bar, baz>{foo}.name() == "foo");
+    CHECK(error<foo, some_bar, baz>{some_bar}.name() == "some_bar");
+    CHECK(error<foo, some_bar, baz>{baz}.name() == "baz");
+    CHECK(error<foo, static_cast<named_error>(7)>{static_cast<named_error>(7)}.name().empty());
+}
+EVAL_TEST_CASE("enumerator names");
+
+TEST_CASE("formatting", "[error]")
+{
+    using enum named_error;
+
+    CHECK(std::format("{}", error<foo, some_bar, baz>{some_bar}) == "some_bar");
+    CHECK(std::format("{:>5}", error<foo>{}) == "  foo");
+    CHECK(std::format("{}", error<foo, static_cast<named_error>(-7)>{static_cast<named_error>(-7)}) == "-7");
+
+    char       buffer[8];
+    auto const result = std::format_to_n(buffer, sizeof(buffer), "{}", error<baz>{});
+    CHECK(std::string(buffer, result.out) == "baz");
+}
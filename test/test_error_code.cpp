@@ -0,0 +1,103 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "err/error.hpp"
+#include "err/error_code.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#include <cstdint>
+
+using namespace err;
+
+namespace
+{
+enum some_error
+{
+    foo,
+    bar,
+    baz,
+};
+
+enum class other_error : std::int8_t
+{
+    first = -3,
+    second,
+};
+
+enum class sparse_error : unsigned
+{
+    listed   = 1000,
+    unlisted = 2000,
+};
+
+enum class wide_error : std::uint64_t
+{
+    small = 1,
+    large = 0x1'0000'0000,
+};
+} // namespace
+
+TEST_CASE("error_code", "[error_code]")
+{
+    CHECK(std::is_error_code_enum_v<error<foo, bar>>);
+    CHECK(std::is_nothrow_convertible_v<error<foo, bar>, std::error_code>);
+    CHECK(!std::is_convertible_v<error<wide_error::small, wide_error::large>, std::error_code>);
+    CHECK(&enum_category<some_error>() == &enum_category<some_error>());
+    CHECK(enum_category<some_error>() != enum_category<other_error>());
+
+    std::error_code const ec = error<foo, bar>{bar};
+    CHECK(ec.value() == bar);
+    CHECK(ec.category() == enum_category<some_error>());
+    CHECK(ec.message() == "bar");
+    CHECK(std::string_view{ec.category().name()}.ends_with("some_error"));
+    CHECK(make_error_code(error<other_error::first>{}).message() == "first");
+    CHECK(make_error_code(error<other_error::first>{}).value() == -3);
+    CHECK(enum_category<some_error>().message(42).ends_with("some_error value 42"));
+
+    CHECK(from_error_code<error<foo, bar>>(ec) == bar);
+    CHECK(from_error_code<error<bar, baz>>(ec) == bar);
+    CHECK(from_error_code<error<foo, baz>>(ec) == std::nullopt);
+    CHECK(from_error_code<error<other_error::first, other_error::second>>(ec) == std::nullopt);
+    CHECK(from_error_code<error<foo, bar>>(std::error_code{}) == std::nullopt);
+    CHECK(from_error_code<error<foo, bar>>(std::make_error_code(std::errc::invalid_argument)) == std::nullopt);
+    CHECK(from_error_code<error<other_error::first>>(std::error_code{300, enum_category<other_error>()})
+          == std::nullopt);
+    CHECK(from_error_code<error<other_error::second>>(std::error_code{-2, enum_category<other_error>()})
+          == other_error::second);
+}
+
+TEST_CASE("error_code messages", "[error_code]")
+{
+    // Names come from the enumerators of the errors that were converted, regardless of their values
+    std::error_code const ec = error<sparse_error::listed>{};
+    CHECK(ec.message() == "listed");
+    CHECK(enum_category<sparse_error>().message(2000).ends_with("sparse_error value 2000"));
+    CHECK(enum_category<sparse_error>().message(-1).ends_with("sparse_error value -1"));
+}
@@ -0,0 +1,124 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "err/error.hpp"
+#include "err/error_map.hpp"
+#include "err/overloaded.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <concepts>
+#include <iterator>
+#include <ranges>
+#include <thread>
+#include <vector>
+
+using namespace err;
+
+namespace
+{
+enum some_error
+{
+    foo,
+    bar,
+    baz,
+};
+
+using error_type = error<foo, bar, baz>;
+} // namespace
+
+TEST_CASE("error_map", "[error_map]")
+{
+    CHECK(error_map<error_type, int>::size() == 3);
+    CHECK(sizeof(error_map<error_type, int>) == 3 * sizeof(int));
+    CHECK(std::ranges::forward_range<error_map<error_type, int>>);
+    CHECK(std::ranges::forward_range<error_map<error_type, int> const>);
+
+    error_map<error_type, int> map;
+    CHECK(map[error_type{foo}] == 0);
+    CHECK(map[error_type{bar}] == 0);
+
+    map[error_type{bar}] = 5;
+    map[error<baz>{}] += 2;
+    CHECK(map[error_type{bar}] == 5);
+    CHECK(map[error_type{baz}] == 2);
+    CHECK(map.values()[1] == 5);
+
+    std::vector<error_type> keys;
+    std::vector<int>        values;
+    for (auto [e, value] : map)
+    {
+        keys.push_back(e);
+        values.push_back(value);
+        ++value;
+    }
+    CHECK(keys == std::vector{error_type{foo}, error_type{bar}, error_type{baz}});
+    CHECK(values == std::vector{0, 5, 2});
+    CHECK(map[error_type{foo}] == 1);
+
+    error_map<error_type, int> const& cmap = map;
+    error_map<error_type, int>::const_iterator it = map.begin();
+    CHECK(it == cmap.begin());
+    CHECK((*it).first == foo);
+    CHECK(std::same_as<decltype((*it).second), int const&>);
+}
+EVAL_TEST_CASE("error_map");
+
+TEST_CASE("error_map from visitor", "[error_map]")
+{
+    constexpr error_map<error_type, int> map{overloaded{
+        [](error<foo>) { return 1; },
+        [](error<bar>) { return 2; },
+        [](error<baz>) { return 3; },
+    }};
+    CHECK(map[error_type{foo}] == 1);
+    CHECK(map[error_type{bar}] == 2);
+    CHECK(map[error_type{baz}] == 3);
+
+    error_map<error_type, error_type> const identity{[](error_type e) { return e; }};
+    for (auto [key, value] : identity)
+        CHECK(key == value);
+}
+EVAL_TEST_CASE("error_map from visitor");
+
+TEST_CASE("atomic_error_map", "[error_map]")
+{
+    atomic_error_map<error_type, int> counters;
+    CHECK(counters[error_type{foo}].load() == 0);
+
+    {
+        std::vector<std::jthread> threads;
+        for (int i = 0; i < 4; ++i)
+            threads.emplace_back(
+                [&]
+                {
+                    for (int j = 0; j < 1000; ++j)
+                        counters[error_type{bar}].fetch_add(1, std::memory_order_relaxed);
+                });
+    }
+    CHECK(counters[error_type{bar}].load() == 4000);
+
+    atomic_error_map<error_type, int> const initialized{[](auto) { return 7; }};
+    CHECK(initialized[error_type{baz}].load() == 7);
+}
@@ -0,0 +1,149 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "err/error_with.hpp"
+#include "err/overloaded.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <concepts>
+#include <expected>
+#include <source_location>
+#include <type_traits>
+
+#include <cstddef>
+
+using namespace err;
+
+namespace
+{
+enum some_error
+{
+    foo,
+    bar,
+    baz,
+};
+
+struct io_context
+{
+    int         errno_value;
+    std::size_t offset;
+
+    constexpr auto operator==(io_context const&) const -> bool = default;
+};
+
+struct oversized_payload
+{
+    std::byte bytes[max_payload_size + 1];
+};
+
+template<class Error, typename Payload>
+concept valid_error_with = requires { typename error_with<Error, Payload>; };
+} // namespace
+
+TEST_CASE("error_with: payloads are stored inline", "[error_with]")
+{
+    // Trivially copyable types can't own memory, so neither copying nor destroying them allocates
+    CHECK(std::is_trivially_copyable_v<error_with<error<foo, bar>, io_context>>);
+    CHECK(std::is_trivially_copyable_v<error_with<error<foo, bar>, std::source_location>>);
+    CHECK(std::is_nothrow_constructible_v<error_with<error<foo, bar>, io_context>, error<foo>, io_context>);
+    CHECK(sizeof(error_with<error<foo, bar>, io_context>) == sizeof(io_context) + alignof(io_context));
+
+    CHECK(std::is_constructible_v<error_with<error<foo, bar>, io_context>, error<foo>, io_context>);
+    CHECK(valid_error_with<error<foo, bar>, io_context>);
+    CHECK(!valid_error_with<error<foo, bar>, oversized_payload>);
+    CHECK(!valid_error_with<error<foo, bar>, io_context const>);
+}
+EVAL_TEST_CASE("error_with: payloads are stored inline");
+
+TEST_CASE("error_with: construction & conversion", "[error_with]")
+{
+    error_with<error<foo, bar>, io_context> e{bar, {.errno_value = 5, .offset = 42}};
+    CHECK(e == bar);
+    CHECK(e.error() == bar);
+    CHECK(e.payload() == io_context{5, 42});
+    CHECK(e.name() == "bar");
+
+    error_with<error<foo, bar, baz>, io_context> ee = e;
+    CHECK(ee == bar);
+    CHECK(ee.payload() == io_context{5, 42});
+    CHECK(std::is_convertible_v<error_with<error<foo, bar>, io_context>, error_with<error<foo, bar, baz>, io_context>>);
+    CHECK(
+        !std::is_convertible_v<error_with<error<foo, bar, baz>, io_context>, error_with<error<foo, bar>, io_context>>);
+    CHECK(!std::is_constructible_v<error_with<error<foo>, io_context>, error_with<error<bar>, io_context>>);
+    CHECK(!std::is_constructible_v<error_with<error<foo>, io_context>, error_with<error<foo>, int>>);
+
+    ee = error_with<error<baz>, io_context>{error<baz>{}, {.errno_value = 2, .offset = 0}};
+    CHECK(ee == baz);
+    CHECK(ee.payload() == io_context{2, 0});
+
+    auto const narrowed = static_cast<error_with<error<bar, baz>, io_context>>(ee);
+    CHECK(narrowed == baz);
+    CHECK(narrowed.payload() == io_context{2, 0});
+
+    std::expected<int, error_with<error<foo, bar, baz>, io_context>> ex = e;
+    CHECK(!ex.has_value());
+    CHECK(ex.error() == bar);
+}
+EVAL_TEST_CASE("error_with: construction & conversion");
+
+TEST_CASE("error_with: equality", "[error_with]")
+{
+    error_with<error<foo, bar>, io_context> const a{foo, {1, 2}};
+    error_with<error<foo, bar>, io_context> const b{foo, {1, 3}};
+    CHECK(a == a);
+    CHECK(a != b);
+    CHECK(a == error<foo>{});
+    CHECK(a != error<bar, baz>{bar});
+}
+EVAL_TEST_CASE("error_with: equality");
+
+TEST_CASE("error_with: visit & transform", "[error_with]")
+{
+    error_with<error<foo, bar>, io_context> const e{bar, {7, 0}};
+
+    CHECK(e.visit(overloaded{
+        [](error<foo>) { return 1; },
+        [](error<bar>) { return 2; },
+    }) == 2);
+    CHECK(e.visit<long>([](auto) { return 3; }) == 3);
+
+    auto const t = e.transform(overloaded{
+        [](error<foo>) { return error<baz>{}; },
+        [](error<bar>) { return error<foo>{}; },
+    });
+    CHECK(std::same_as<decltype(t), error_with<error<foo, baz>, io_context> const>);
+    CHECK(t == foo);
+    CHECK(t.payload() == io_context{7, 0});
+}
+EVAL_TEST_CASE("error_with: visit & transform");
+
+TEST_CASE("error_with: common_type", "[error_with]")
+{
+    CHECK(std::same_as<std::common_type_t<error_with<error<foo>, int>, error_with<error<bar>, int>>,
+                       error_with<error<foo, bar>, int>>);
+    CHECK(std::same_as<std::common_type_t<error_with<error<foo, bar>, int>, error_with<error<baz>, int>>,
+                       error_with<error<foo, bar, baz>, int>>);
+}
+EVAL_TEST_CASE("error_with: common_type");
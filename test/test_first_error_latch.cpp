@@ -0,0 +1,93 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "err/error.hpp"
+#include "err/first_error_latch.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <atomic>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+using namespace err;
+
+namespace
+{
+enum some_error
+{
+    foo,
+    bar,
+    baz,
+};
+
+using error_type = error<foo, bar, baz>;
+} // namespace
+
+TEST_CASE("first_error_latch", "[first_error_latch]")
+{
+    CHECK(std::atomic<error_type>::is_always_lock_free);
+
+    first_error_latch<error_type> latch;
+    CHECK(!latch.has_error());
+    CHECK(latch.load() == std::nullopt);
+
+    CHECK(latch.try_set(error_type{baz}));
+    CHECK(!latch.try_set(error_type{foo}));
+    CHECK(latch.has_error());
+    CHECK(latch.load() == baz);
+    CHECK(latch.wait() == baz);
+
+    latch.reset();
+    CHECK(!latch.has_error());
+    CHECK(latch.try_set(error_type{foo}));
+    CHECK(latch.load() == foo);
+}
+
+TEST_CASE("first_error_latch across threads", "[first_error_latch]")
+{
+    first_error_latch<error_type> latch;
+    std::stop_source              stop;
+    std::atomic<int>              winners = 0;
+    {
+        std::vector<std::jthread> threads;
+        threads.emplace_back([&] { CHECK(latch.wait() != foo); });
+        for (int i = 0; i < 8; ++i)
+            threads.emplace_back(
+                [&, i]
+                {
+                    auto const token = stop.get_token();
+                    for (int j = 0; j < 1000 && !token.stop_requested(); ++j)
+                    {
+                        if (j == 10 * i && latch.try_set(error_type{i % 2 == 0 ? bar : baz}, stop))
+                            winners.fetch_add(1, std::memory_order_relaxed);
+                    }
+                });
+    }
+    CHECK(winners.load() == 1);
+    CHECK(stop.stop_requested());
+    CHECK(latch.load() != foo);
+}
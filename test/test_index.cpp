@@ -0,0 +1,95 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "err/error.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <concepts>
+#include <functional>
+#include <unordered_set>
+
+using namespace err;
+
+namespace
+{
+enum some_error
+{
+    foo = 3,
+    bar = 1,
+    baz = 2,
+};
+} // namespace
+
+TEST_CASE("index", "[error]")
+{
+    using error_type = error<foo, bar, baz>;
+
+    for (std::size_t i = 0; i < error_type::possible_values.size(); ++i)
+    {
+        auto const e = error_type::from_index(i);
+        CHECK(e.index() == i);
+        CHECK(e == error_type::possible_values[i]);
+        CHECK(error_type{error_type::possible_values[i]}.index() == i);
+    }
+    CHECK(error<foo>{}.index() == 0);
+}
+EVAL_TEST_CASE("index");
+
+TEST_CASE("ordering", "[error]")
+{
+    using error_type = error<foo, bar, baz>;
+
+    CHECK(std::totally_ordered<error_type>);
+    CHECK(std::ranges::is_sorted(error_type::possible_values));
+    CHECK(error_type{bar} < error_type{baz});
+    CHECK(error_type{foo} > error_type{baz});
+    CHECK(error_type{baz} <= error_type{baz});
+    CHECK((error_type{bar} <=> error_type{bar}) == std::strong_ordering::equal);
+    CHECK(error_type{baz} < foo);
+    CHECK(error_type{baz} > bar);
+    CHECK(error<bar>{} < error_type{baz});
+
+    std::array errors{error_type{foo}, error_type{bar}, error_type{baz}, error_type{bar}};
+    std::ranges::sort(errors);
+    CHECK(errors == std::array{error_type{bar}, error_type{bar}, error_type{baz}, error_type{foo}});
+}
+EVAL_TEST_CASE("ordering");
+
+TEST_CASE("hash", "[error]")
+{
+    using error_type = error<foo, bar, baz>;
+
+    std::hash<error_type> const hash;
+    CHECK(hash(error_type{bar}) == error_type{bar}.index());
+    CHECK(hash(error_type{foo}) != hash(error_type{baz}));
+
+    std::unordered_set<error_type> const set{error_type{foo}, error_type{baz}, error_type{foo}};
+    CHECK(set.size() == 2);
+    CHECK(set.contains(error_type{baz}));
+    CHECK(!set.contains(error_type{bar}));
+}
@@ -0,0 +1,118 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "err/error.hpp"
+#include "err/instrumentation.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cstdint>
+
+using namespace err;
+
+namespace
+{
+enum class counted_error
+{
+    foo = 1,
+    bar = 2,
+    baz = -3,
+};
+
+auto count_of(std::vector<error_count> const& counts, std::string const& value) -> std::uint64_t
+{
+    auto const iter = std::ranges::find_if(counts,
+                                           [&](error_count const& c)
+                                           { return c.type.ends_with("counted_error") && c.value == value; });
+    return iter == counts.end() ? 0 : iter->count;
+}
+} // namespace
+
+TEST_CASE("instrumentation", "[instrumentation]")
+{
+    using enum counted_error;
+
+    auto const before = error_counts();
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back(
+            []
+            {
+                for (int j = 0; j < 1000; ++j)
+                {
+                    error<foo, bar> e{foo};
+                    CHECK(e == foo);
+                }
+            });
+    }
+    for (auto& t : threads)
+        t.join();
+
+    error<bar>{bar};
+    error<foo, bar>{bar}.transform([](auto) { return error<baz>{}; });
+
+    constexpr error<foo, bar> constant{foo}; // not counted
+    CHECK(constant == foo);
+
+    auto const after = error_counts();
+    CHECK(count_of(after, "1") - count_of(before, "1") == 4000);
+    CHECK(count_of(after, "2") - count_of(before, "2") == 2);
+    CHECK(count_of(after, "-3") - count_of(before, "-3") == 1);
+
+    std::ostringstream os;
+    write_prometheus(os, after);
+    auto const text = os.str();
+    CHECK(text.starts_with("# HELP err_errors_total"));
+    CHECK(text.find("value=\"baz\"} " + std::to_string(count_of(after, "-3")) + "\n") != std::string::npos);
+    CHECK(text.find("value=\"-3\"") == std::string::npos);
+
+    auto const counted = std::ranges::find(after, "2", &error_count::value);
+    REQUIRE(counted != after.end());
+    CHECK(counted->name == "bar");
+}
+
+TEST_CASE("instrumentation of unnamed values", "[instrumentation]")
+{
+    constexpr auto unnamed = static_cast<counted_error>(7);
+    error<counted_error::foo, unnamed>{unnamed};
+
+    std::ostringstream os;
+    write_prometheus(os, error_counts());
+    CHECK(os.str().find("value=\"7\"} 1\n") != std::string::npos);
+}
+
+TEST_CASE("instrumentation shards don't share cache lines", "[instrumentation]")
+{
+    using shard = detail::counter_shard<error<counted_error::foo, counted_error::bar>>;
+    CHECK(alignof(shard) == detail::cache_line_size);
+    CHECK(sizeof(shard) % detail::cache_line_size == 0);
+}
@@ -0,0 +1,193 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "err/error.hpp"
+#include "err/overloaded.hpp"
+#include "err/result.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <expected>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <cstdint>
+
+using namespace err;
+
+namespace
+{
+enum some_error
+{
+    foo,
+    bar,
+};
+
+enum other_error
+{
+    baz,
+    bam,
+    bom,
+};
+
+constexpr auto do_the_foo(int i) -> result<int, error<foo, bar>>
+{
+    if (i > 0)
+        return i;
+    if (i == 0)
+        return error<foo>{};
+    return error<bar>{};
+}
+
+constexpr auto do_the_bar(int i) -> result<int, error<baz, bam, bom>>
+{
+    if (i % 2 != 0)
+        return error<bom>{};
+    auto const r = do_the_foo(i);
+    return transform_error(
+        overloaded{
+            [](error<foo>) { return error<bam>{}; },
+            [](error<bar>) { return error<baz>{}; },
+        },
+        r);
+}
+
+constexpr auto do_the_baz(int i) -> result<int, error<baz, bam, bom>>
+{
+    auto r = do_the_bar(i);
+    return r.transform([](int j) { return j * 2; });
+}
+} // namespace
+
+TEST_CASE("result layout", "[result]")
+{
+    CHECK(sizeof(result<void, error<foo, bar>>) == 1);
+    CHECK(sizeof(result<void, error<foo, bar>>) < sizeof(std::expected<void, error<foo, bar>>));
+    CHECK(sizeof(result<std::uint8_t, error<foo, bar>>) == 2);
+    CHECK(sizeof(result<std::uint32_t, error<foo, bar>>) == 8);
+    CHECK(sizeof(result<std::uint32_t, error<foo, bar>>) <= sizeof(std::expected<std::uint32_t, error<foo, bar>>));
+    CHECK(std::is_trivially_copyable_v<result<void, error<foo, bar>>>);
+    CHECK(std::is_trivially_copyable_v<result<int, error<foo, bar>>>);
+    CHECK(!std::is_trivially_copyable_v<result<std::string, error<foo, bar>>>);
+}
+EVAL_TEST_CASE("result layout");
+
+TEST_CASE("result of an error", "[result]")
+{
+    using value_error = error<baz, bam, bom>;
+    using result_type = result<value_error, error<foo, bar>>;
+
+    // The errors of E are stored in unused positions of the value, so there is no discriminator
+    CHECK(sizeof(result_type) == sizeof(value_error));
+    CHECK(sizeof(result_type) < sizeof(std::expected<value_error, error<foo, bar>>));
+    CHECK(std::is_trivially_copyable_v<result_type>);
+
+    result_type r{std::in_place, bom};
+    REQUIRE(r.has_value());
+    CHECK(*r == bom);
+
+    r = error<bar>{};
+    REQUIRE(!r.has_value());
+    CHECK(r.error() == bar);
+
+    r = value_error{baz};
+    REQUIRE(r.has_value());
+    CHECK(*r == baz);
+
+    auto const e = result_type{error<foo>{}};
+    CHECK(!e.has_value());
+    CHECK(e.error() == foo);
+    CHECK(e.value_or(value_error{bam}) == bam);
+    CHECK(r.transform([](value_error v) { return v == baz; }) == true);
+}
+EVAL_TEST_CASE("result of an error");
+
+TEST_CASE("result construction", "[result]")
+{
+    CHECK(std::is_convertible_v<int, result<int, error<foo, bar>>>);
+    CHECK(std::is_convertible_v<error<foo>, result<int, error<foo, bar>>>);
+    CHECK(!std::is_convertible_v<error<foo, bar>, result<int, error<foo>>>);
+    CHECK(std::is_constructible_v<result<int, error<foo>>, error<foo, bar>>);
+    CHECK(!std::is_constructible_v<result<int, error<foo>>, error<bar>>);
+
+    result<void, error<foo, bar>> v;
+    CHECK(v.has_value());
+    v = error<bar>{};
+    CHECK(!v.has_value());
+    CHECK(v.error() == bar);
+    CHECK(v == error<bar>{});
+    CHECK(v == std::unexpected{error<bar>{}});
+
+    result<int, error<foo, bar>> r{std::unexpect, foo};
+    CHECK(r.error() == foo);
+    CHECK(r.value_or(3) == 3);
+    r = 42;
+    CHECK(r == 42);
+    CHECK(*r == 42);
+    CHECK(r.value_or(3) == 42);
+
+    std::expected<int, error<foo, bar>> const e = r;
+    CHECK(e == 42);
+    result<int, error<foo, bar>> const back = std::expected<int, error<foo, bar>>{std::unexpect, bar};
+    CHECK(back == error<bar>{});
+}
+EVAL_TEST_CASE("result construction");
+
+TEST_CASE("result non-trivial payload", "[result]")
+{
+    result<std::string, error<foo, bar>> r{"a long string that does not fit into the small buffer"};
+    CHECK(r.has_value());
+    auto copy = r;
+    CHECK(copy == r);
+    r = error<foo>{};
+    CHECK(r == error<foo>{});
+    r = copy;
+    CHECK(r == copy);
+    auto moved = std::move(copy);
+    CHECK(*moved == *r);
+    CHECK(r.transform([](std::string const& s) { return s.size(); }) == 53U);
+
+    auto const* const data       = r->data();
+    auto              translated = transform_error([](auto) { return error<baz>{}; }, std::move(r));
+    CHECK(translated.has_value());
+    CHECK(translated->data() == data);
+}
+
+TEST_CASE("result monadic operations", "[result]")
+{
+    CHECK(do_the_bar(2) == 2);
+    CHECK(do_the_bar(1) == std::unexpected{error<bom>{}});
+    CHECK(do_the_bar(0) == std::unexpected{error<bam>{}});
+    CHECK(do_the_bar(-2) == std::unexpected{error<baz>{}});
+
+    CHECK(do_the_baz(2) == 4);
+    CHECK(do_the_baz(1) == std::unexpected{error<bom>{}});
+    CHECK(do_the_baz(0) == std::unexpected{error<bam>{}});
+    CHECK(do_the_baz(-2) == std::unexpected{error<baz>{}});
+
+    CHECK(do_the_foo(1).and_then([](int i) { return result<int, error<foo, bar>>{i + 1}; }) == 2);
+    CHECK(do_the_foo(0).or_else([](error<foo, bar>) { return result<int, error<baz>>{7}; }) == 7);
+}
+EVAL_TEST_CASE("result monadic operations");
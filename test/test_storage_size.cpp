@@ -0,0 +1,82 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "err/error.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+using namespace err;
+
+namespace
+{
+enum class wide_error : std::uint64_t
+{
+    foo = 1,
+    bar = 0xFFFF'FFFF'FFFF'FFFF,
+};
+
+enum class many_errors : std::uint32_t
+{
+};
+
+template<class Seq>
+struct make_error;
+
+template<std::size_t... Is>
+struct make_error<std::index_sequence<Is...>>
+{
+    using type = error<static_cast<many_errors>(Is * 7)...>;
+};
+
+template<std::size_t N>
+using error_of_size = make_error<std::make_index_sequence<N>>::type;
+} // namespace
+
+TEST_CASE("storage size", "[error]")
+{
+    using enum wide_error;
+
+    CHECK(sizeof(error<foo>) == 1);
+    CHECK(sizeof(error<foo, bar>) == 1);
+    CHECK(alignof(error<foo, bar>) == 1);
+    CHECK(std::is_trivially_copyable_v<error<foo, bar>>);
+    CHECK(sizeof(error_of_size<2>) == 1);
+    CHECK(sizeof(error_of_size<256>) == 1);
+    CHECK(sizeof(error_of_size<257>) == 2);
+
+    error<foo, bar> e{bar};
+    CHECK(e == bar);
+    CHECK(static_cast<wide_error>(e) == bar);
+    e = error<foo>{};
+    CHECK(e == foo);
+
+    error_of_size<257> const last{static_cast<many_errors>(256 * 7)};
+    CHECK(last == static_cast<many_errors>(256 * 7));
+    CHECK(last != static_cast<many_errors>(255 * 7));
+}
+EVAL_TEST_CASE("storage size");
@@ -57,5 +57,15 @@ TEST_CASE("transform", "[error]")
                   return error<bar, baz, bam>(e);
               })
           == bam);
+
+    int  calls    = 0;
+    auto counting = [&calls](auto e)
+    {
+        ++calls;
+        return e;
+    };
+    CHECK(ee.transform(counting) == foo);
+    CHECK(ee.transform(counting) == foo);
+    CHECK(calls == 2);
 }
 EVAL_TEST_CASE("transform");
\ No newline at end of file
@@ -26,6 +26,8 @@
 
 #include <bugspray/bugspray.hpp>
 #include <expected>
+#include <memory>
+#include <utility>
 
 using namespace err;
 
@@ -82,4 +84,21 @@ TEST_CASE("use with expected", "[error]")
     CHECK(do_the_baz(0) == std::unexpected{error<bam>{}});
     CHECK(do_the_baz(-2) == std::unexpected{error<baz>{}});
 }
-EVAL_TEST_CASE("use with expected");
\ No newline at end of file
+EVAL_TEST_CASE("use with expected");
+
+TEST_CASE("use with expected and move-only payload", "[error]")
+{
+    auto const translate = overloaded{
+        [](error<foo>) { return error<bam>{}; },
+        [](error<bar>) { return error<baz>{}; },
+    };
+
+    std::expected<std::unique_ptr<int>, error<foo, bar>> good{std::make_unique<int>(42)};
+    auto const* const                                    payload    = good->get();
+    auto                                                 translated = transform_error(translate, std::move(good));
+    CHECK(translated.has_value());
+    CHECK(translated->get() == payload);
+
+    std::expected<std::unique_ptr<int>, error<foo, bar>> bad{std::unexpect, error<bar>{}};
+    CHECK(transform_error(translate, std::move(bad)) == std::unexpected{error<baz>{}});
+}
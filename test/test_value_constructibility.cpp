@@ -59,4 +59,40 @@ TEST_CASE("value-constructibility", "[error]")
     CHECK(error<foo, bar, baz>{bar} == bar);
     CHECK(error<foo, bar, baz>{baz} == baz);
 }
-EVAL_TEST_CASE("value-constructibility");
\ No newline at end of file
+EVAL_TEST_CASE("value-constructibility");
+
+TEST_CASE("value-constructibility of sparse errors", "[error]")
+{
+    enum class sparse_error : long long
+    {
+        a = -3,
+        b = 5,
+        c = 60,
+        d = 1'000,
+        e = 4'000,
+        f = 1LL << 40,
+        g = -(1LL << 50),
+    };
+    using enum sparse_error;
+
+    // Within 64 values of each other
+    CHECK(error<a, b, c>{a} == a);
+    CHECK(error<a, b, c>{b} == b);
+    CHECK(error<a, b, c>{c} == c);
+    CHECK(static_cast<sparse_error>(error<a, b, c>{b}) == b);
+
+    // Within a few words of bits per value
+    CHECK(error<a, b, c, d, e>{a} == a);
+    CHECK(error<a, b, c, d, e>{d} == d);
+    CHECK(error<a, b, c, d, e>{e} == e);
+    CHECK(static_cast<sparse_error>(error<a, b, c, d, e>{d}) == d);
+
+    // Arbitrarily far apart
+    CHECK(error<a, b, f, g>{a} == a);
+    CHECK(error<a, b, f, g>{b} == b);
+    CHECK(error<a, b, f, g>{f} == f);
+    CHECK(error<a, b, f, g>{g} == g);
+    CHECK(static_cast<sparse_error>(error<a, b, f, g>{g}) == g);
+    CHECK(error<a, b, f, g>{f} != g);
+}
+EVAL_TEST_CASE("value-constructibility of sparse errors");
@@ -26,6 +26,8 @@
 
 #include <bugspray/bugspray.hpp>
 
+#include <concepts>
+
 using namespace err;
 
 TEST_CASE("visit", "[error]")
@@ -63,4 +65,133 @@ TEST_CASE("visit", "[error]")
               ee)
           == 2);
 }
-EVAL_TEST_CASE("visit");
\ No newline at end of file
+EVAL_TEST_CASE("visit");
+
+TEST_CASE("visit without errors", "[error]")
+{
+    // Like std::visit, the visitor is called once without arguments
+    CHECK(visit([] { return 42; }) == 42);
+    CHECK(visit<long>([] { return 42; }) == 42L);
+    CHECK(visit(optimize_for_size, [] { return 42; }) == 42);
+}
+EVAL_TEST_CASE("visit without errors");
+
+TEST_CASE("visit non-contiguous enumerators", "[error]")
+{
+    enum class sparse_error
+    {
+        a = -7,
+        b = 3,
+        c = 4,
+        d = 1000,
+    };
+    using enum sparse_error;
+
+    auto const to_int = overloaded{
+        [](error<a>) { return 1; },
+        [](error<b>) { return 2; },
+        [](error<c>) { return 3; },
+        [](error<d>) { return 4; },
+    };
+    CHECK(error<a, b, c, d>{a}.visit(to_int) == 1);
+    CHECK(error<a, b, c, d>{b}.visit(to_int) == 2);
+    CHECK(error<a, b, c, d>{c}.visit(to_int) == 3);
+    CHECK(error<a, b, c, d>{d}.visit(to_int) == 4);
+    CHECK(visit(to_int, error<d, a>{d}) == 4);
+    CHECK(error<a, d>{a}.visit<long>(to_int) == 1L);
+
+    auto const combine = overloaded{
+        [](error<a>, error<d>, error<c>) { return 1; },
+        [](error<b>, error<d>, error<c>) { return 2; },
+        [](auto, auto, auto) { return 3; },
+    };
+    CHECK(visit(combine, error<a, b>{a}, error<c, d>{d}, error<b, c>{c}) == 1);
+    CHECK(visit(combine, error<a, b>{b}, error<c, d>{d}, error<b, c>{c}) == 2);
+    CHECK(visit(combine, error<a, b>{b}, error<c, d>{c}, error<b, c>{c}) == 3);
+    CHECK(visit<long>(combine, error<a, b>{a}, error<c, d>{d}, error<b, c>{b}) == 3L);
+}
+EVAL_TEST_CASE("visit non-contiguous enumerators");
+
+TEST_CASE("match", "[error]")
+{
+    enum class some_error : signed char
+    {
+        foo = -1,
+        bar,
+        baz,
+        bam = 100,
+    };
+    using enum some_error;
+
+    auto const handle = [](auto e)
+    {
+        switch (match(e))
+        {
+        case foo: return 1;
+        case bar: return 2;
+        case baz: return 3;
+        case bam: return 4;
+        }
+        return 0;
+    };
+    CHECK(handle(error<foo, bar, baz>{foo}) == 1);
+    CHECK(handle(error<foo, bar, baz>{bar}) == 2);
+    CHECK(handle(error<foo, bar, baz>{baz}) == 3);
+    CHECK(handle(error<bar, bam>{bam}) == 4);
+    CHECK(static_cast<some_error>(error<foo, bar, baz>{foo}) == foo);
+    CHECK(std::same_as<decltype(match(error<foo>{})), some_error>);
+}
+EVAL_TEST_CASE("match");
+
+TEST_CASE("match on part of an enumeration", "[error]")
+{
+    enum class some_error
+    {
+        foo,
+        bar,
+        baz,
+    };
+    using enum some_error;
+
+    // match returns value_type rather than an enumeration of just the possible values, so -Wswitch (an error in this
+    // build) requires the case for baz, although error<foo, bar> can never hold it
+    auto const handle = [](error<foo, bar> e)
+    {
+        switch (match(e))
+        {
+        case foo: return 1;
+        case bar: return 2;
+        case baz: return 3;
+        }
+        return 0;
+    };
+    CHECK(std::same_as<decltype(match(error<foo, bar>{foo})), some_error>);
+    CHECK(handle(error<foo, bar>{foo}) == 1);
+    CHECK(handle(error<foo, bar>{bar}) == 2);
+}
+EVAL_TEST_CASE("match on part of an enumeration");
+
+TEST_CASE("visit strategies", "[error]")
+{
+    enum some_error
+    {
+        foo,
+        bar,
+        baz,
+    };
+
+    auto const to_int = overloaded{
+        [](error<foo>) { return 1; },
+        [](error<bar>) { return 2; },
+        [](error<baz>) { return 3; },
+    };
+    auto const combine = [&](auto lhs, auto rhs) { return to_int(lhs) * 10 + to_int(rhs); };
+
+    CHECK(visit(optimize_for_speed, to_int, error<foo, bar>{bar}) == 2);
+    CHECK(visit(optimize_for_size, to_int, error<foo, bar>{bar}) == 2);
+    CHECK(visit(optimize_for_size, to_int, error<bar, baz>{baz}) == 3);
+    CHECK(visit<long>(optimize_for_size, to_int, error<foo, baz>{foo}) == 1L);
+    CHECK(visit(optimize_for_size, combine, error<foo, bar>{bar}, error<baz>{}) == 23);
+    CHECK(visit<long>(optimize_for_speed, combine, error<foo>{}, error<bar, baz>{bar}) == 12L);
+}
+EVAL_TEST_CASE("visit strategies");
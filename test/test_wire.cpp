@@ -0,0 +1,138 @@
+//
+// MIT License
+//
+// Copyright (c) 2023 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "err/error.hpp"
+#include "err/wire.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <algorithm>
+#include <array>
+#include <expected>
+#include <span>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace err;
+
+namespace
+{
+enum class wire_test_error
+{
+    foo,
+    bar,
+    baz,
+    bam,
+    bom = 100,
+};
+
+// Errors aren't default-constructible, so arrays of them are built element by element
+template<std::size_t N, class Fn>
+constexpr auto make_array(Fn fn)
+{
+    return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+    { return std::array{fn(Is)...}; }(std::make_index_sequence<N>{});
+}
+} // namespace
+
+TEST_CASE("wire encoding of single errors", "[wire]")
+{
+    using enum wire_test_error;
+    using error_type = error<foo, bar, baz, bam, bom>;
+
+    CHECK(wire_bits_v<error<foo>> == 0);
+    CHECK(wire_bits_v<error<foo, bar>> == 1);
+    CHECK(wire_bits_v<error<foo, bar, baz, bam>> == 2);
+    CHECK(wire_bits_v<error_type> == 3);
+    CHECK(sizeof(wire_code_t<error_type>) == 1);
+
+    CHECK(wire_fingerprint_v<error<foo, bar>> == wire_fingerprint_v<error<bar, foo>>);
+    CHECK(wire_fingerprint_v<error<foo, bar>> != wire_fingerprint_v<error<foo, baz>>);
+    CHECK(wire_fingerprint_v<error<foo, bar>> != wire_fingerprint_v<error<foo, bar, baz>>);
+
+    CHECK(decode<error_type>(encode(error_type{bom})) == error_type{bom});
+    CHECK(decode<error_type>(encode(error_type{foo})) == error_type{foo});
+    CHECK(decode<error_type>(5) == std::unexpected{wire_error{wire_errc::invalid_value}});
+}
+EVAL_TEST_CASE("wire encoding of single errors");
+
+TEST_CASE("wire encoding of batches", "[wire]")
+{
+    using enum wire_test_error;
+    using error_type = error<foo, bar, baz, bam, bom>;
+
+    // 3 bits per error, so some codes straddle two words
+    auto const errors = make_array<50>(
+        [](std::size_t i)
+        { return error_type{error_type::possible_values[(i * 7) % error_type::possible_values.size()]}; });
+
+    std::array<std::uint64_t, 5> words{};
+    CHECK(encoded_size<error_type>(errors.size()) == 5);
+    CHECK(encode(errors, words) == 5);
+    CHECK(words[1] == 50);
+
+    auto decoded = make_array<50>([](std::size_t) { return error_type{bar}; });
+    CHECK(decode(words, decoded) == 50);
+    CHECK(decoded == errors);
+
+    auto other = make_array<50>([](std::size_t) { return error<foo, bar, baz, bam>{foo}; });
+    CHECK(decode(words, other) == std::unexpected{wire_error{wire_errc::schema_mismatch}});
+    CHECK(decode(std::span{words}.first(4), decoded) == std::unexpected{wire_error{wire_errc::truncated}});
+    CHECK(decode(std::span{words}.first(1), decoded) == std::unexpected{wire_error{wire_errc::truncated}});
+    CHECK(decode(std::span{words}.first(0), decoded) == std::unexpected{wire_error{wire_errc::truncated}});
+    CHECK(decode(std::span{words}.first(1), other) == std::unexpected{wire_error{wire_errc::truncated}});
+
+    words[2] |= 0b111; // code 7 is not a valid position
+    CHECK(decode(words, decoded) == std::unexpected{wire_error{wire_errc::invalid_value}});
+
+    auto                         singles = make_array<1000>([](std::size_t) { return error<foo>{}; });
+    std::array<std::uint64_t, 2> single_words{};
+    CHECK(encode(singles, single_words) == 2);
+    CHECK(decode(single_words, singles) == 1000);
+}
+EVAL_TEST_CASE("wire encoding of batches");
+
+TEST_CASE("wire encoding of batches with a different count", "[wire]")
+{
+    using enum wire_test_error;
+    using error_type = error<foo, bar, baz, bam, bom>;
+
+    auto const errors = make_array<3>([](std::size_t) { return error_type{bom}; });
+
+    // Trailing zero words would decode as foo if the count weren't part of the header
+    std::array<std::uint64_t, 8> words{};
+    CHECK(encode(errors, words) == 3);
+
+    auto larger = make_array<10>([](std::size_t) { return error_type{bar}; });
+    CHECK(decode(words, larger) == 3);
+    CHECK(std::ranges::equal(std::span{larger}.first(3), errors));
+    CHECK(std::ranges::all_of(std::span{larger}.subspan(3), [](error_type e) { return e == bar; }));
+
+    auto smaller = make_array<2>([](std::size_t) { return error_type{bar}; });
+    CHECK(decode(words, smaller) == std::unexpected{wire_error{wire_errc::count_mismatch}});
+    CHECK(decode(words, std::span{larger}.first(2)) == std::unexpected{wire_error{wire_errc::count_mismatch}});
+}
+EVAL_TEST_CASE("wire encoding of batches with a different count");